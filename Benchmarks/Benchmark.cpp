@@ -7,16 +7,36 @@
 
 #include <OpenXLSX.hpp>
 #include <benchmark/benchmark.h>
+#include <atomic>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
 #include <numeric>
 #include <deque>
 #include <list>
+#include <random>
+#include <string>
+#include <vector>
 
 using namespace OpenXLSX;
 
 constexpr uint64_t rowCount = 1048576;
 constexpr uint8_t  colCount = 8;
 
+// ===== Count heap allocations, to report the allocations per cell of the iteration benchmarks
+static std::atomic<uint64_t> allocationCount { 0 };
+
+void* operator new(std::size_t size)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
 /**
  * @brief
  * @param state
@@ -89,6 +109,30 @@ static void BM_WriteFloats(benchmark::State& state)    // NOLINT
 
 BENCHMARK(BM_WriteFloats)->Unit(benchmark::kMillisecond);    // NOLINT
 
+/**
+ * @brief write the same floats as BM_WriteFloats, from a contiguous array with XLWorksheet::writeBlock
+ * @param state
+ */
+static void BM_WriteBlockFloats(benchmark::State& state)    // NOLINT
+{
+    XLDocument doc;
+    doc.create("./benchmark_block_floats.xlsx");
+    auto wks    = doc.workbook().worksheet("Sheet1");
+
+    std::vector<double> values(rowCount * colCount, 3.14);
+
+    for (auto _ : state)    // NOLINT
+        wks.writeBlock<double>(XLCellReference("A1"), rowCount, colCount, values.data());
+
+    state.SetItemsProcessed(state.iterations() * rowCount * colCount);
+    state.counters["items"] = state.items_processed();
+
+    doc.save();
+    doc.close();
+}
+
+BENCHMARK(BM_WriteBlockFloats)->Unit(benchmark::kMillisecond);    // NOLINT
+
 /**
  * @brief
  * @param state
@@ -246,4 +290,189 @@ static void BM_ReadBools(benchmark::State& state)    // NOLINT
 
 BENCHMARK(BM_ReadBools)->Unit(benchmark::kMillisecond);    // NOLINT
 
+/**
+ * @brief Iterate all cells of a worksheet through an XLCellRange, reporting heap allocations per cell
+ * @param state
+ */
+static void BM_IterateCellRange(benchmark::State& state)    // NOLINT
+{
+    XLDocument doc;
+    doc.open("./benchmark_integers.xlsx");
+    auto     wks    = doc.workbook().worksheet("Sheet1");
+    auto     range  = wks.range();
+    uint64_t result = 0;
+
+    const uint64_t allocationsBefore = allocationCount;
+    for (auto _ : state) {    // NOLINT
+        for (auto& cell : range) result += (cell.value().type() == XLValueType::Integer);
+
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * rowCount * colCount);
+    state.counters["items"]       = state.items_processed();
+    state.counters["allocs/cell"] = static_cast<double>(allocationCount - allocationsBefore) / static_cast<double>(state.items_processed());
+
+    doc.close();
+}
+
+BENCHMARK(BM_IterateCellRange)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief Iterate all cells of a worksheet row by row through XLRowDataRange, reporting heap allocations per cell
+ * @param state
+ */
+static void BM_IterateRowCells(benchmark::State& state)    // NOLINT
+{
+    XLDocument doc;
+    doc.open("./benchmark_integers.xlsx");
+    auto     wks    = doc.workbook().worksheet("Sheet1");
+    uint64_t result = 0;
+
+    const uint64_t allocationsBefore = allocationCount;
+    for (auto _ : state) {    // NOLINT
+        for (auto& row : wks.rows())
+            for (auto& cell : row.cells()) result += (cell.value().type() == XLValueType::Integer);
+
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * rowCount * colCount);
+    state.counters["items"]       = state.items_processed();
+    state.counters["allocs/cell"] = static_cast<double>(allocationCount - allocationsBefore) / static_cast<double>(state.items_processed());
+
+    doc.close();
+}
+
+BENCHMARK(BM_IterateRowCells)->Unit(benchmark::kMillisecond);    // NOLINT
+
+// ===== XLNumberCodec: the conversion of numeric cell values to and from the text of their <v> nodes, without pugixml and zip.
+//       The snprintf / strtod benchmarks are the baseline, as used by pugixml xml_text::set(double) and xml_text::as_double.
+
+/**
+ * @brief get rowCount doubles, uniformly distributed in [0, 1000) with a fixed seed
+ */
+static const std::vector<double>& codecValues()
+{
+    static const std::vector<double> values = [] {
+        std::mt19937_64                        generator(7);
+        std::uniform_real_distribution<double> distribution(0, 1000);
+        std::vector<double>                    result(rowCount);
+        for (auto& value : result) value = distribution(generator);
+        return result;
+    }();
+    return values;
+}
+
+/**
+ * @brief get the <v> texts of codecValues, as written by snprintf "%.17g" (useCodec = false) or XLNumberCodec::format
+ */
+static std::vector<std::string> codecTexts(bool useCodec)
+{
+    std::vector<std::string> texts;
+    texts.reserve(rowCount);
+    char buffer[XLMaxNumberChars];
+    for (const double value : codecValues()) {
+        if (useCodec)
+            XLNumberCodec::format(value, buffer);
+        else
+            snprintf(buffer, XLMaxNumberChars, "%.17g", value);
+        texts.emplace_back(buffer);
+    }
+    return texts;
+}
+
+/**
+ * @brief report the average length of the <v> texts
+ */
+static void setTextLengthCounter(benchmark::State& state, const std::vector<std::string>& texts)
+{
+    const size_t length = std::accumulate(texts.begin(), texts.end(), size_t { 0 }, [](size_t sum, const std::string& text) { return sum + text.size(); });
+    state.counters["chars/value"] = static_cast<double>(length) / static_cast<double>(texts.size());
+}
+
+/**
+ * @brief format doubles with snprintf "%.17g"
+ * @param state
+ */
+static void BM_FormatDoublesSnprintf(benchmark::State& state)    // NOLINT
+{
+    const std::vector<double>& values = codecValues();
+    char                       buffer[XLMaxNumberChars];
+
+    for (auto _ : state) {    // NOLINT
+        for (const double value : values) {
+            snprintf(buffer, XLMaxNumberChars, "%.17g", value);
+            benchmark::DoNotOptimize(buffer);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+    setTextLengthCounter(state, codecTexts(false));
+}
+
+BENCHMARK(BM_FormatDoublesSnprintf)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief format doubles with XLNumberCodec::format
+ * @param state
+ */
+static void BM_FormatDoubles(benchmark::State& state)    // NOLINT
+{
+    const std::vector<double>& values = codecValues();
+    char                       buffer[XLMaxNumberChars];
+
+    for (auto _ : state) {    // NOLINT
+        for (const double value : values) {
+            XLNumberCodec::format(value, buffer);
+            benchmark::DoNotOptimize(buffer);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+    setTextLengthCounter(state, codecTexts(true));
+}
+
+BENCHMARK(BM_FormatDoubles)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief parse the "%.17g" texts of doubles with strtod
+ * @param state
+ */
+static void BM_ParseDoublesStrtod(benchmark::State& state)    // NOLINT
+{
+    const std::vector<std::string> texts  = codecTexts(false);
+    double                         result = 0;
+
+    for (auto _ : state) {    // NOLINT
+        for (const auto& text : texts) result += strtod(text.c_str(), nullptr);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations() * texts.size());
+}
+
+BENCHMARK(BM_ParseDoublesStrtod)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief parse the XLNumberCodec texts of doubles with XLNumberCodec::parseDouble
+ * @param state
+ */
+static void BM_ParseDoubles(benchmark::State& state)    // NOLINT
+{
+    const std::vector<std::string> texts  = codecTexts(true);
+    double                         result = 0;
+
+    for (auto _ : state) {    // NOLINT
+        for (const auto& text : texts) result += XLNumberCodec::parseDouble(text.c_str());
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations() * texts.size());
+}
+
+BENCHMARK(BM_ParseDoubles)->Unit(benchmark::kMillisecond);    // NOLINT
+
 #pragma warning(pop)
@@ -55,8 +55,12 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include "headers/XLDocument.hpp"
 #include "headers/XLException.hpp"
 #include "headers/XLFormula.hpp"
+#include "headers/XLNumberCodec.hpp"
 #include "headers/XLRow.hpp"
 #include "headers/XLSheet.hpp"
+#include "headers/XLStreamReader.hpp"
+#include "headers/XLStreamWriter.hpp"
+#include "headers/XLTypedRow.hpp"
 #include "headers/XLWorkbook.hpp"
 #include "headers/XLZipArchive.hpp"
 
@@ -1,3 +1,5 @@
+include(CMakeFindDependencyMacro)
+find_dependency(Threads)    # std::thread, linked privately - needed for the static library
 include("${CMAKE_CURRENT_LIST_DIR}/OpenXLSXTargets.cmake")
 # # TBD: the below do not appear to be necessary, nor do they seem to have any effect?
 # if (OPENXLSX_ENABLE_NOWIDE)
@@ -55,11 +55,62 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
 
+#include <cstddef>    // size_t
+#include <cstdint>    // uint8_t
 #include <memory>
 #include <string>
 
 namespace OpenXLSX
 {
+    /**
+     * @brief How an archive file is brought into memory when it is opened
+     */
+    enum class XLZipOpenMode : uint8_t {
+        Buffered,        /**< read the complete archive file into a heap buffer (default) */
+        MemoryMapped     /**< map the archive file read-only into memory, pages are loaded lazily by the OS */
+    };
+
+    /**
+     * @brief Interface of a sequential reader for a single archive entry, decompressing the entry data as it is read
+     * @note An entry stream must not be used after the archive that created it has been closed or saved
+     */
+    class OPENXLSX_EXPORT XLZipEntryStream
+    {
+    public:
+        virtual ~XLZipEntryStream() = default;
+
+        /**
+         * @brief Read the next chunk of entry data
+         * @param buffer The destination buffer
+         * @param size The capacity of buffer in bytes
+         * @return The number of bytes written to buffer, 0 at the end of the entry
+         */
+        virtual size_t read(char* buffer, size_t size) = 0;
+    };
+
+    /**
+     * @brief Interface of a sequential writer for a new archive entry, that compresses (or spools) the entry data as it is written
+     * @note An entry writer must be committed before the archive that created it is saved or closed
+     */
+    class OPENXLSX_EXPORT XLZipEntryWriter
+    {
+    public:
+        virtual ~XLZipEntryWriter() = default;
+
+        /**
+         * @brief Append data to the entry
+         * @param data The data to append
+         * @param size The size of data in bytes
+         */
+        virtual void write(const char* data, size_t size) = 0;
+
+        /**
+         * @brief Complete the entry and add it to the archive. The writer can not be used afterwards.
+         * @param name The name of the entry - an existing entry of the same name is overwritten
+         */
+        virtual void commit(const std::string& name) = 0;
+    };
+
     /**
      * @brief This class functions as a wrapper around any class that provides the necessary functionality for
      * a zip archive.
@@ -156,12 +207,20 @@ namespace OpenXLSX
             m_zipArchive->open(fileName);
         }
 
+        inline void setOpenMode(XLZipOpenMode openMode) {
+            m_zipArchive->setOpenMode(openMode);
+        }
+
+        inline XLZipOpenMode openMode() const {
+            return m_zipArchive->openMode();
+        }
+
         inline void close() const {
             m_zipArchive->close();
         }
 
-        inline void save(const std::string& path) {
-            m_zipArchive->save(path);
+        inline void save(const std::string& path, unsigned int compressionThreads = 1) {
+            m_zipArchive->save(path, compressionThreads);
         }
 
         inline void addEntry(const std::string& name, const std::string& data) {
@@ -180,6 +239,18 @@ namespace OpenXLSX
             return m_zipArchive->getEntry(name);
         }
 
+        inline void* getEntryBuffer(const std::string& name, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*)) {
+            return m_zipArchive->getEntryBuffer(name, size, allocate, deallocate);
+        }
+
+        inline std::unique_ptr<XLZipEntryStream> openEntryStream(const std::string& name) {
+            return m_zipArchive->openEntryStream(name);
+        }
+
+        inline std::unique_ptr<XLZipEntryWriter> openEntryWriter() {
+            return m_zipArchive->openEntryWriter();
+        }
+
         inline bool hasEntry(const std::string& entryName) const {
             return m_zipArchive->hasEntry(entryName);
         }
@@ -235,9 +306,13 @@ namespace OpenXLSX
 
             inline virtual void open(const std::string& fileName) = 0;
 
+            inline virtual void setOpenMode(XLZipOpenMode openMode) = 0;
+
+            inline virtual XLZipOpenMode openMode() const = 0;
+
             inline virtual void close() = 0;
 
-            inline virtual void save (const std::string& path) = 0;
+            inline virtual void save (const std::string& path, unsigned int compressionThreads) = 0;
 
             inline virtual void addEntry(const std::string& name, const std::string& data) = 0;
 
@@ -247,6 +322,12 @@ namespace OpenXLSX
 
             inline virtual std::string getEntry(const std::string& name) = 0;
 
+            inline virtual void* getEntryBuffer(const std::string& name, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*)) = 0;
+
+            inline virtual std::unique_ptr<XLZipEntryStream> openEntryStream(const std::string& name) = 0;
+
+            inline virtual std::unique_ptr<XLZipEntryWriter> openEntryWriter() = 0;
+
             inline virtual bool hasEntry(const std::string& entryName) const = 0;
 
         };
@@ -317,12 +398,20 @@ namespace OpenXLSX
                 ZipType.open(fileName);
             }
 
+            inline void setOpenMode(XLZipOpenMode openMode) override {
+                ZipType.setOpenMode(openMode);
+            }
+
+            inline XLZipOpenMode openMode() const override {
+                return ZipType.openMode();
+            }
+
             inline void close() override {
                 ZipType.close();
             }
 
-            inline void save(const std::string& path) override {
-                ZipType.save(path);
+            inline void save(const std::string& path, unsigned int compressionThreads) override {
+                ZipType.save(path, compressionThreads);
             }
 
             inline void addEntry(const std::string& name, const std::string& data) override {
@@ -341,6 +430,18 @@ namespace OpenXLSX
                 return ZipType.getEntry(name);
             }
 
+            inline void* getEntryBuffer(const std::string& name, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*)) override {
+                return ZipType.getEntryBuffer(name, size, allocate, deallocate);
+            }
+
+            inline std::unique_ptr<XLZipEntryStream> openEntryStream(const std::string& name) override {
+                return ZipType.openEntryStream(name);
+            }
+
+            inline std::unique_ptr<XLZipEntryWriter> openEntryWriter() override {
+                return ZipType.openEntryWriter();
+            }
+
             inline bool hasEntry(const std::string& entryName) const override {
                 return ZipType.hasEntry(entryName);
             }
@@ -62,6 +62,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include "XLCellValue.hpp"
 #include "XLFormula.hpp"
 #include "XLSharedStrings.hpp"
+#include "XLSheetBounds.hpp"
 #include "XLStyles.hpp"          // XLStyleIndex
 #include "XLXmlParserForwardDeclarations.hpp"
 
@@ -83,7 +84,9 @@ namespace OpenXLSX
     class OPENXLSX_EXPORT XLCell
     {
         friend class XLCellIterator;
+        friend class XLExistingCellIterator;
         friend class XLCellValueProxy;
+        friend class XLFormulaProxy;
         friend class XLRowDataIterator;
         friend bool operator==(const XLCell& lhs, const XLCell& rhs);
         friend bool operator!=(const XLCell& lhs, const XLCell& rhs);
@@ -100,8 +103,9 @@ namespace OpenXLSX
          * @brief
          * @param cellNode
          * @param sharedStrings
+         * @param sheetBounds (optional) the column extent of the parent worksheet, to be updated when offset creates a cell
          */
-        XLCell(const XMLNode& cellNode, const XLSharedStrings& sharedStrings);
+        XLCell(const XMLNode& cellNode, const XLSharedStrings& sharedStrings, XLSheetBounds* sheetBounds = nullptr);
 
         /**
          * @brief Copy constructor
@@ -241,11 +245,17 @@ namespace OpenXLSX
          */
         static bool isEqual(const XLCell& lhs, const XLCell& rhs);
 
+        /**
+         * @brief Record a modification of the cell in the parent worksheet, if known, see XLSheetBounds::markModified
+         */
+        void markModified() const;
+
         //---------- Private Member Variables ---------- //
-        std::unique_ptr<XMLNode> m_cellNode;      /**< A pointer to the root XMLNode for the cell. */
-        XLSharedStringsRef       m_sharedStrings; /**< */
-        XLCellValueProxy         m_valueProxy;    /**< */
-        XLFormulaProxy           m_formulaProxy;  /**< */
+        XMLNodeStorage     m_cellNode;      /**< The root XMLNode for the cell, held inline to avoid an allocation per cell. */
+        XLSharedStringsRef m_sharedStrings; /**< */
+        XLCellValueProxy   m_valueProxy;    /**< */
+        XLFormulaProxy     m_formulaProxy;  /**< */
+        XLSheetBoundsRef   m_sheetBounds {nullptr}; /**< The column extent and modification state of the parent worksheet, if known */
     };
 
     class OPENXLSX_EXPORT XLCellAssignable : public XLCell
@@ -204,12 +204,12 @@ namespace OpenXLSX
         std::string address() const;
 
     private:
-        std::unique_ptr<XMLNode> m_dataNode;             /**< */
+        XMLNodeStorage           m_dataNode;             /**< */
         XLCellReference          m_topLeft;              /**< The cell reference of the first cell in the range */
         XLCellReference          m_bottomRight;          /**< The cell reference of the last cell in the range */
         XLSharedStringsRef       m_sharedStrings;        /**< */
         bool                     m_endReached;           /**< */
-        std::unique_ptr<XMLNode> m_hintNode;             /**< The cell node of the last existing cell found up to current iterator position */
+        XMLNodeStorage           m_hintNode;             /**< The cell node of the last existing cell found up to current iterator position */
         uint32_t                 m_hintRow;              /**<   the row number for m_hintCell */
         XLCell                   m_currentCell;          /**< The cell to which the iterator is currently pointing, if it exists, otherwise an empty XLCell */
         static constexpr const int XLNotLoaded  = 0;    // code readability for m_currentCellStatus
@@ -219,6 +219,7 @@ namespace OpenXLSX
         uint32_t                 m_currentRow;
         uint16_t                 m_currentColumn;
         std::vector<XLStyleIndex> const * m_colStyles;
+        XLSheetBoundsRef         m_sheetBounds;          /**< the column extent of the parent worksheet, if known */
     };
 
     /**
@@ -232,6 +233,110 @@ namespace OpenXLSX
         os << it.address();
         return os;
     }
+
+    /**
+     * @brief Forward iterator over the cells of an XLCellRange that exist in the XML. It follows the <row> and <c> siblings
+     *        of the sheetData node and skips all holes, so its cost depends on the number of existing cells, not on the
+     *        area of the range. Dereferencing never creates a cell.
+     */
+    class OPENXLSX_EXPORT XLExistingCellIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = XLCell;
+        using difference_type   = int64_t;
+        using pointer           = XLCell*;
+        using reference         = XLCell&;
+
+        /**
+         * @brief
+         * @param cellRange the range whose existing cells shall be visited
+         * @param loc XLIteratorLocation::Begin positions the iterator on the first existing cell in cellRange,
+         *            XLIteratorLocation::End creates the beyond-the-end iterator
+         */
+        explicit XLExistingCellIterator(const XLCellRange& cellRange, XLIteratorLocation loc);
+
+        /**
+         * @brief
+         * @return
+         */
+        XLExistingCellIterator& operator++();
+
+        /**
+         * @brief
+         * @return
+         */
+        XLExistingCellIterator operator++(int);    // NOLINT
+
+        /**
+         * @brief
+         * @return
+         */
+        reference operator*();
+
+        /**
+         * @brief
+         * @return
+         */
+        pointer operator->();
+
+        /**
+         * @brief
+         * @param rhs
+         * @return
+         */
+        bool operator==(const XLExistingCellIterator& rhs) const;
+
+        /**
+         * @brief
+         * @param rhs
+         * @return
+         */
+        bool operator!=(const XLExistingCellIterator& rhs) const;
+
+        /**
+         * @brief determine whether iterator is at 1 beyond the last existing cell in range
+         * @return
+         */
+        bool endReached() const { return m_endReached; }
+
+        /**
+         * @brief get the row number of the cell that the iterator points to
+         * @return the row number, 0 for the beyond-the-end iterator
+         */
+        uint32_t row() const { return m_currentRow; }
+
+        /**
+         * @brief get the column number of the cell that the iterator points to
+         * @return the column number, 0 for the beyond-the-end iterator
+         */
+        uint16_t column() const { return m_currentColumn; }
+
+        /**
+         * @brief get the reference of the cell that the iterator points to
+         * @return an XLCellReference
+         * @throw XLInputError if endReached() == true
+         */
+        XLCellReference cellReference() const;
+
+    private:
+        /**
+         * @brief position the iterator on the first cell node at or after cellNode in rowNode - continuing with the following rows - that
+         *        lies within the range, or on the end if there is none
+         * @param rowNode the row node to start from
+         * @param cellNode the cell node in rowNode to start from, may be empty
+         */
+        void seek(XMLNode rowNode, XMLNode cellNode);
+
+        XLCellReference    m_topLeft;          /**< The cell reference of the first cell in the range */
+        XLCellReference    m_bottomRight;      /**< The cell reference of the last cell in the range */
+        XLSharedStringsRef m_sharedStrings;    /**< */
+        XLSheetBoundsRef   m_sheetBounds;      /**< the column extent of the parent worksheet, if known, passed on to the cells */
+        XLCell             m_currentCell;      /**< The existing cell to which the iterator is currently pointing */
+        uint32_t           m_currentRow;       /**< the row number of m_currentCell */
+        uint16_t           m_currentColumn;    /**< the column number of m_currentCell */
+        bool               m_endReached;       /**< */
+    };
 }    // namespace OpenXLSX
 
 // ===== Template specialization for std::distance.
@@ -64,6 +64,9 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 namespace OpenXLSX
 {
+    class XLExistingCellRange;
+    class XLRowIndex;
+
     /**
      * @brief This class encapsulates the concept of a cell range, i.e. a square area
      * (or subset) of cells in a spreadsheet.
@@ -71,6 +74,7 @@ namespace OpenXLSX
     class OPENXLSX_EXPORT XLCellRange
     {
         friend class XLCellIterator;
+        friend class XLExistingCellIterator;
 
         //----------------------------------------------------------------------------------------------------------------------
         //           Public Member Functions
@@ -88,11 +92,15 @@ namespace OpenXLSX
          * @param topLeft
          * @param bottomRight
          * @param sharedStrings
+         * @param sheetBounds (optional) the column extent of the parent worksheet, to be updated when iterating creates cells
+         * @param rowIndex (optional) the row index of the parent worksheet, to locate the first row of the range
          */
         explicit XLCellRange(const XMLNode&         dataNode,
                              const XLCellReference& topLeft,
                              const XLCellReference& bottomRight,
-                             const XLSharedStrings& sharedStrings);
+                             const XLSharedStrings& sharedStrings,
+                             XLSheetBounds*         sheetBounds = nullptr,
+                             XLRowIndex*            rowIndex    = nullptr);
 
         /**
          * @brief Copy constructor
@@ -173,6 +181,13 @@ namespace OpenXLSX
          */
         XLCellIterator end() const;
 
+        /**
+         * @brief get a view of the range that only visits the cells that exist in the XML
+         * @return an XLExistingCellRange for use in range-based for loops
+         * @note unlike begin() / end(), iterating over the result never creates cells and skips empty rows and columns entirely
+         */
+        XLExistingCellRange existingCells() const;
+
         /**
          * @brief
          */
@@ -213,6 +228,36 @@ namespace OpenXLSX
         XLCellReference           m_bottomRight;   /**< reference to the last cell in the range */
         XLSharedStringsRef        m_sharedStrings; /**< reference to the document shared strings table */
         std::vector<XLStyleIndex> m_columnStyles;  /**< quick access to column styles in the range - populated by fetchColumnStyles() */
+        XLSheetBoundsRef          m_sheetBounds;   /**< the column extent of the parent worksheet, if known */
+        XLRowIndex*               m_rowIndex;      /**< the row index of the parent worksheet, if known */
+    };
+
+    /**
+     * @brief A view of an XLCellRange that only visits the existing cells, as returned by XLCellRange::existingCells()
+     */
+    class OPENXLSX_EXPORT XLExistingCellRange
+    {
+    public:
+        /**
+         * @brief
+         * @param cellRange the range to visit
+         */
+        explicit XLExistingCellRange(const XLCellRange& cellRange);
+
+        /**
+         * @brief
+         * @return an iterator to the first existing cell in the range
+         */
+        XLExistingCellIterator begin() const;
+
+        /**
+         * @brief
+         * @return the beyond-the-end iterator
+         */
+        XLExistingCellIterator end() const;
+
+    private:
+        XLCellRange m_cellRange; /**< the range to visit */
     };
 }    // namespace OpenXLSX
 
@@ -246,6 +246,21 @@ namespace OpenXLSX
          */
         static XLCoordinates coordinatesFromAddress(const std::string& address);
 
+        /**
+         * @brief Decode the column number of a cell address (e.g. 'C7' yields 3) without constructing an XLCellReference.
+         * @param address The NUL-terminated cell address, typically the "r" attribute of a cell node.
+         * @return The column number, or 0 if address does not start with a valid column (1-3 uppercase letters, <= MAX_COLS).
+         * @note Table driven and allocation free, intended for the cell lookup hot paths.
+         */
+        static uint16_t columnFromAddress(const char* address) noexcept;
+
+        /**
+         * @brief Decode the row number of a cell address (e.g. 'C7' yields 7) without constructing an XLCellReference.
+         * @param address The NUL-terminated cell address.
+         * @return The row number, or 0 if address is not a valid cell address.
+         */
+        static uint32_t rowFromAddress(const char* address) noexcept;
+
         //----------------------------------------------------------------------------------------------------------------------
         //           Private Member Variables
         //----------------------------------------------------------------------------------------------------------------------
@@ -57,6 +57,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include <cstdint>
 #include <iostream> // std::ostream
 #include <string>   // std::hash, also defined in <variant>
+#include <type_traits>
 #include <variant>  // std::variant
 
 // ===== OpenXLSX Includes ===== //
@@ -73,6 +74,8 @@ namespace OpenXLSX
 {
     //---------- Forward Declarations ----------//
     class XLCellValueProxy;
+    template<typename... Ts>
+    class XLTypedRowReader;
     class XLCell;
 
     /**
@@ -429,6 +432,8 @@ namespace OpenXLSX
         friend class XLCell;
         friend class XLCellValue;
         friend class XLDocument; // for reindexing shared strings
+        template<typename... Ts>
+        friend class XLTypedRowReader; // for access to getTyped
 
     public:
         //---------- Public Member Functions ----------//
@@ -552,6 +557,20 @@ namespace OpenXLSX
          */
         XLCellValueProxy& setError(const std::string& error);
 
+        /**
+         * @brief Set the cell to a string value stored in the shared strings table (t="s"), regardless of the string write policy.
+         * @param value The string.
+         * @return A reference to the current object.
+         */
+        XLCellValueProxy& setSharedString(const std::string& value);
+
+        /**
+         * @brief Set the cell to a string value stored inline in the cell (t="inlineStr"), regardless of the string write policy.
+         * @param value The string.
+         * @return A reference to the current object.
+         */
+        XLCellValueProxy& setInlineString(const std::string& value);
+
         /**
          * @brief Get the value type for the cell.
          * @return An XLCellValue corresponding to the cell value.
@@ -648,11 +667,23 @@ namespace OpenXLSX
         void setFloat(double numberValue);
 
         /**
-         * @brief Set the cell to a string value.
+         * @brief Set the cell to a string value, stored as the string write policy of the document demands.
          * @param stringValue The value to be set.
          */
         void setString(const char* stringValue);
 
+        /**
+         * @brief Set the cell to a shared string.
+         * @param index The index of the string in the shared strings table.
+         */
+        void writeSharedString(int32_t index);
+
+        /**
+         * @brief Set the cell to an inline string.
+         * @param stringValue The value to be set.
+         */
+        void writeInlineString(const char* stringValue);
+
         /**
          * @brief Get a copy of the XLCellValue object for the cell.
          * @return An XLCellValue object.
@@ -673,6 +704,43 @@ namespace OpenXLSX
          */
         bool setStringIndex(int32_t newIndex);
 
+        /**
+         * @brief release the reference of the cell to its shared string, if the value is a shared string - before the value changes
+         */
+        void releaseSharedString();
+
+        /**
+         * @brief get the value as type T without constructing an XLCellValue, with the conversions of XLCellValue::get<T>
+         * @tparam T bool, an integer or floating point type, XLDateTime or std::string
+         * @return The value.
+         * @throw XLValueTypeError if the value is not convertible to T
+         */
+        template<typename T>
+        T getTyped() const
+        {
+            if constexpr (std::is_same_v<T, bool>)
+                return getBoolean();
+            else if constexpr (std::is_integral_v<T>)
+                return static_cast<T>(getInteger());
+            else if constexpr (std::is_floating_point_v<T>)
+                return static_cast<T>(getFloat());
+            else if constexpr (std::is_same_v<T, XLDateTime>)
+                return XLDateTime(getFloat());
+            else {
+                static_assert(std::is_same_v<T, std::string>, "getTyped supports bool, integer & floating point types, XLDateTime and std::string");
+                return getStringValue();
+            }
+        }
+
+        /**
+         * @brief typed getters for getTyped
+         * @throw XLValueTypeError if the value is not of the requested type (getFloat: not convertible to double)
+         */
+        bool        getBoolean() const;
+        int64_t     getInteger() const;
+        double      getFloat() const;
+        std::string getStringValue() const;
+
         //---------- Private Member Variables ---------- //
 
         XLCell*  m_cell;     /**< Pointer to the owning XLCell object. */
@@ -54,8 +54,10 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 // ===== External Includes ===== //
 #include <algorithm> // std::find_if
+#include <future>    // std::shared_future
 #include <list>
 #include <string>
+#include <vector>
 
 // ===== OpenXLSX Includes ===== //
 #include "IZipArchive.hpp"
@@ -75,11 +77,46 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 namespace OpenXLSX
 {
-    extern const unsigned int pugi_parse_settings;    // defined in XLDocument.cpp
+    extern const unsigned int pugi_parse_settings;              // defined in XLDocument.cpp
+    extern const unsigned int pugi_parse_settings_read_only;    //  "     - used for documents opened with XLOpenOptions::readOnly
 
     constexpr const bool XLForceOverwrite = true;     // readability constant for 2nd parameter of XLDocument::saveAs
     constexpr const bool XLDoNotOverwrite = false;    //  "
 
+    constexpr const unsigned int XLDefaultCompressionThreads = 1; // readability constants for the compressionThreads parameter of
+    constexpr const unsigned int XLAutoCompressionThreads    = 0; //  XLDocument::save / saveAs: sequential / one per hardware thread
+
+    constexpr const uint64_t XLNoMemoryBudget = 0;    // readability constant for XLDocument::setMemoryBudget: no limit (default)
+
+    /**
+     * @brief Options that control how XLDocument::open loads a document
+     */
+    struct XLOpenOptions
+    {
+        bool                     preParseWorksheets {false}; /**< if true, parse worksheets concurrently during open instead of on first access */
+        std::vector<std::string> preParseSheets {};          /**< the names of the sheets to pre-parse - empty = all worksheets */
+        unsigned int             preParseThreads {0};        /**< the amount of threads used to pre-parse, 0 = one per hardware thread */
+        bool                     readOnly {false};           /**< if true, open for extraction only: skip the repair of document properties,
+                                                              *   construct XLStyles on first use, parse without whitespace nodes and reject
+                                                              *   saving, shared string modifications and other document level
+                                                              *   modifications */
+
+        /**
+         * @brief get the options for a read-only document, see readOnly
+         * @return XLOpenOptions with readOnly set
+         * @note only saving and the modifications that affect the whole document are rejected (properties, sheets, shared
+         *  strings, ...). Cell values and other worksheet content can still be modified in memory, e.g. to store a number,
+         *  but such changes are not blocked and are never saved. With the default XLStringWritePolicy, a string that is not
+         *  in the shared strings yet can not be stored in a cell, as appending it to the shared strings is rejected.
+         */
+        static XLOpenOptions readOnlyProfile()
+        {
+            XLOpenOptions options;
+            options.readOnly = true;
+            return options;
+        }
+    };
+
     /**
      * @brief The XLDocumentProperties class is an enumeration of the possible properties (metadata) that can be set
      * for a XLDocument object (and .xlsx file)
@@ -120,6 +157,9 @@ namespace OpenXLSX
         friend class XLWorkbook;
         friend class XLSheet;
         friend class XLXmlData;
+        friend class XLStreamReader;
+        friend class XLStreamWriter;
+        friend class XLSharedStrings;
 
         //---------- Public Member Functions
     public:
@@ -183,6 +223,97 @@ namespace OpenXLSX
          */
         void open(const std::string& fileName);
 
+        /**
+         * @brief Open the .xlsx file with the given path
+         * @param fileName The path of the .xlsx file to open
+         * @param options The XLOpenOptions to use, e.g. to parse all worksheets concurrently while opening
+         */
+        void open(const std::string& fileName, const XLOpenOptions& options);
+
+        /**
+         * @brief Load the XML document of a sheet on a background thread, so that it is ready when the sheet is accessed,
+         *  e.g. to parse sheet N+1 while sheet N is processed
+         * @param sheetName The name of the sheet to load
+         * @return A future that becomes ready when the sheet has been loaded. Waiting on it is optional: the first access to the
+         *  sheet waits for the load, and rethrows a load error.
+         * @throw XLInputError if the sheet does not exist
+         * @note Operations that modify the archive (save, close, adding or deleting sheets, ...) wait for pending loads first
+         */
+        std::shared_future<void> prefetch(const std::string& sheetName);
+
+        /**
+         * @brief determine whether the document was opened with XLOpenOptions::readOnly
+         * @return true if the document can not be saved or otherwise modified at document level
+         */
+        bool isReadOnly() const;
+
+        /**
+         * @brief Limit the memory held by parsed worksheets. When a worksheet is loaded and the loaded worksheets exceed the
+         *  budget, the least recently used worksheets are evicted: unmodified ones are dropped, modified ones are compressed
+         *  into the archive first (the libzip backend spools them to a temporary file). Evicted worksheets are reloaded
+         *  from the archive on next access.
+         * @param bytes The budget in bytes of worksheet XML text - a parsed worksheet takes a multiple of that in memory.
+         *  XLNoMemoryBudget (0) = no limit
+         * @note XLCell, XLRow and XLCellRange objects (and their iterators) pin their worksheet: it is not evicted while they
+         *  exist, even if that exceeds the budget. Let them go out of scope before moving on to other worksheets.
+         * @warning Other objects that point into the XML of a worksheet, e.g. XLColumn, XLMergeCells or XLConditionalFormats,
+         *  become invalid when the worksheet is evicted: retrieve the XLWorksheet from the workbook again after accessing
+         *  other worksheets
+         */
+        void setMemoryBudget(uint64_t bytes);
+
+        /**
+         * @brief get the memory budget for parsed worksheets, see setMemoryBudget
+         * @return the budget in bytes of worksheet XML text, XLNoMemoryBudget (0) = no limit
+         */
+        uint64_t memoryBudget() const;
+
+        /**
+         * @brief get the amount of worksheet evictions by the memory budget since the document was opened
+         */
+        uint64_t evictionCount() const;
+
+        /**
+         * @brief get the amount of evictions of modified worksheets, that had to be written to the archive
+         */
+        uint64_t spillCount() const;
+
+        /**
+         * @brief get the amount of worksheets reloaded from the archive after an eviction
+         */
+        uint64_t reloadCount() const;
+
+        /**
+         * @brief Defer the generation of xl/sharedStrings.xml until the document is saved: new and cleared shared strings are then
+         *  only stored in the shared strings cache, and saving writes the XML directly from the cache, without building a DOM.
+         *  Disabling the mode brings the XML DOM up to date with the cache.
+         * @param deferred true to defer the XML generation, false (default) to update the XML with every change
+         * @note useful for write-heavy jobs, which otherwise grow a DOM node for each new string in addition to the cache
+         * @note the cache holds plain text only: for a document whose shared strings table has rich text or phonetic runs,
+         *  the setting has no effect (the XML is updated with every change), so that the formatting is kept
+         */
+        void setDeferredSharedStrings(bool deferred);
+
+        /**
+         * @brief check if the generation of xl/sharedStrings.xml is deferred until saving, see setDeferredSharedStrings
+         * @return true if deferred - always false for a shared strings table with formatted strings
+         */
+        bool deferredSharedStrings() const;
+
+        /**
+         * @brief Set how string cell values are stored: in the shared strings table, inline in the cell, or adaptively
+         * @param policy The XLStringWritePolicy - the default stores all strings in the shared strings table
+         * @note the policy applies to strings assigned with XLCellValueProxy::operator= / set and written by XLStreamWriter,
+         *  XLCellValueProxy::setSharedString and setInlineString override it for a single value
+         */
+        void setStringWritePolicy(const XLStringWritePolicy& policy);
+
+        /**
+         * @brief get the string write policy, see setStringWritePolicy
+         * @return the XLStringWritePolicy
+         */
+        const XLStringWritePolicy& stringWritePolicy() const;
+
         /**
          * @brief Create a new .xlsx file with the given name.
          * @param fileName The path of the new .xlsx file.
@@ -207,19 +338,27 @@ namespace OpenXLSX
 
         /**
          * @brief Save the current document using the current filename, overwriting the existing file.
+         * @param compressionThreads The amount of threads used to compress modified archive entries,
+         *  XLAutoCompressionThreads (0) = one per hardware thread. Only supported by the default (miniz) zip backend.
          * @throw XLException (OpenXLSX failed checks)
          * @throw ZipRuntimeError (zippy failed archive / file access)
+         * @note shared strings that are no longer referenced by any cell are released. A released string keeps its <si> entry,
+         *  with empty text, unless it is at the end of the table: this way, no cell has to be renumbered. Use
+         *  cleanupSharedStrings to remove these empty entries as well. If a cell released a string read from the file,
+         *  all worksheets are loaded once to count the references first.
          */
-        void save();
+        void save(unsigned int compressionThreads = XLDefaultCompressionThreads);
 
         /**
          * @brief Save the document with a new name. If a file exists with that name, it will be overwritten.
          * @param fileName The path of the file
          * @param forceOverwrite If not true (XLForceOverwrite) and fileName exists, saveAs will throw an exception
+         * @param compressionThreads The amount of threads used to compress modified archive entries,
+         *  XLAutoCompressionThreads (0) = one per hardware thread. Only supported by the default (miniz) zip backend.
          * @throw XLException (OpenXLSX failed checks)
          * @throw ZipRuntimeError (zippy failed archive / file access)
          */
-        void saveAs(const std::string& fileName, bool forceOverwrite);
+        void saveAs(const std::string& fileName, bool forceOverwrite, unsigned int compressionThreads = XLDefaultCompressionThreads);
 
         /**
          * @brief Save the document with a new name. Legacy interface, invokes saveAs( fileName, XLForceOverwrite )
@@ -284,6 +423,7 @@ namespace OpenXLSX
         /**
          * @brief return a handle on the workbook's styles
          * @return a reference to m_styles
+         * @note for a read-only document, XLStyles is constructed on first use
          */
         XLStyles& styles();
 
@@ -404,6 +544,28 @@ namespace OpenXLSX
          */
         std::string extractXmlFromArchive(const std::string& path);
 
+        /**
+         * @brief Parse an XML file from the .xlsx archive into xmlDocument. The inflated entry data is handed over to
+         * pugixml without an intermediate copy.
+         * @param path The relative path of the file.
+         * @param xmlDocument The document to load - will be empty if path does not exist in the archive
+         * @return The size in bytes of the XML text that was parsed
+         */
+        size_t loadXmlFromArchive(const std::string& path, XMLDocument& xmlDocument);
+
+        /**
+         * @brief Open a sequential reader on an XML file in the .xlsx archive, that inflates the file as it is read.
+         * @param path The relative path of the file.
+         * @return The entry stream
+         */
+        std::unique_ptr<XLZipEntryStream> openEntryStream(const std::string& path);
+
+        /**
+         * @brief Open a sequential writer for a new file in the .xlsx archive, that compresses the data as it is written.
+         * @return The entry writer. The file is added to the archive when the writer is committed.
+         */
+        std::unique_ptr<XLZipEntryWriter> openEntryWriter();
+
         /**
          * @brief fetch the XLXmlData object as stored in m_data, throw XLInternalError if path is not found
          * @param path The relative path of the file.
@@ -427,20 +589,81 @@ namespace OpenXLSX
          */
         bool hasXmlData(const std::string& path) const;
 
+        /**
+         * @brief Parse the XML data of parts on a pool of worker threads, each part into its own XMLDocument
+         * @param parts The parts to parse - parts that have been loaded already are skipped
+         * @param threadCount The amount of threads to use, 0 = one per hardware thread
+         * @throw the first exception thrown while parsing any of the parts, after all workers have finished
+         */
+        void preParse(const std::vector<XLXmlData*>& parts, unsigned int threadCount);
+
+        /**
+         * @brief Wait until all background loads started by prefetch have finished - needed before the archive is modified
+         */
+        void waitForPrefetches();
+
+        /**
+         * @brief Evict the least recently used worksheets until the loaded worksheets fit in the memory budget
+         * @param accessed The part that is being accessed - it is never evicted
+         */
+        void enforceMemoryBudget(const XLXmlData* accessed);
+
+        /**
+         * @brief Write xl/sharedStrings.xml from the shared strings cache to the archive, replacing an outdated XML DOM
+         */
+        void writeDeferredSharedStrings();
+
+        /**
+         * @brief Drop the XML document of part, after writing it to the archive if it was modified
+         * @param part The part to evict
+         */
+        void evict(XLXmlData& part);
+
+        /**
+         * @brief Count the cells referencing each shared string, visiting the existing cells of all worksheets, so that the
+         *  strings that are no longer referenced can be released on save
+         * @note loads all worksheets, unlike cleanupSharedStrings it modifies neither the cells nor the shared strings
+         */
+        void countSharedStringReferences();
+
+        /**
+         * @brief throw if the document was opened read-only
+         * @param operation the name of the rejected operation, for the exception message
+         * @throw XLException if the document is read-only
+         */
+        void rejectIfReadOnly(const std::string& operation) const;
+
         //----------------------------------------------------------------------------------------------------------------------
         //           Private Member Variables
         //----------------------------------------------------------------------------------------------------------------------
 
     private:
         bool m_suppressWarnings {true}; /**< If true, will suppress output of warnings where supported */
+        bool m_readOnly {false};        /**< If true, the document was opened with XLOpenOptions::readOnly */
+        unsigned int m_parseSettings {pugi_parse_settings}; /**< the pugixml parse settings for parts loaded from the archive */
 
         std::string m_filePath {};      /**< The path to the original file*/
 
         XLXmlSavingDeclaration m_xmlSavingDeclaration;  /**< The xml saving declaration that will be passed to pugixml before generating the XML output data*/
 
         mutable std::list<XLXmlData>    m_data {};              /**<  */
-        mutable std::deque<std::string> m_sharedStringCache {}; /**<  */
-        mutable XLSharedStrings         m_sharedStrings {};     /**<  */
+        std::vector<std::shared_future<void>> m_prefetches {};  /**< the background loads started by prefetch, see waitForPrefetches */
+
+        uint64_t m_memoryBudget {XLNoMemoryBudget}; /**< the memory budget for parsed worksheets, see setMemoryBudget */
+        uint64_t m_accessClock {0};                 /**< incremented on each access to an XML document, orders parts by recency */
+        uint64_t m_evictionCount {0};               /**< the amount of parts evicted by the memory budget */
+        uint64_t m_spillCount {0};                  /**< the amount of evicted parts that were written to the archive */
+        uint64_t m_reloadCount {0};                 /**< the amount of evicted parts that were loaded again */
+        mutable XLStringArena       m_sharedStringCache {}; /**< the shared strings, decoded from xl/sharedStrings.xml on first use */
+        mutable XLSharedStringIndex m_sharedStringIndex {}; /**< hash index into m_sharedStringCache, maintained by m_sharedStrings */
+        mutable XLSharedStringRefCounts m_sharedStringRefCounts {}; /**< reference counts of m_sharedStringCache, maintained by m_sharedStrings */
+        mutable XLSharedStrings     m_sharedStrings {};     /**<  */
+        bool         m_deferSharedStrings {false};          /**< if true, xl/sharedStrings.xml is written from the cache at save */
+        mutable bool m_sharedStringsXmlOutdated {false};    /**< true if m_sharedStringCache has changes that are not in the XML */
+        mutable bool m_sharedStringReferencesUncounted {false}; /**< true if a string with an unknown reference count was released,
+                                                                  *   see countSharedStringReferences */
+        bool         m_sharedStringsFormatted {false};      /**< true if the loaded shared strings have rich text or phonetic runs */
+        XLStringWritePolicy m_stringWritePolicy {};          /**< how string cell values are stored, see setStringWritePolicy */
 
         XLRelationships m_docRelationships {}; /**< A pointer to the document relationships object*/
         XLRelationships m_wbkRelationships {}; /**< A pointer to the document relationships object*/
@@ -0,0 +1,109 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+#ifndef OPENXLSX_XLNUMBERCODEC_HPP
+#define OPENXLSX_XLNUMBERCODEC_HPP
+
+// ===== External Includes ===== //
+#include <cstddef>    // size_t
+#include <cstdint>    // int64_t
+
+// ===== OpenXLSX Includes ===== //
+#include "OpenXLSX-Exports.hpp"
+
+namespace OpenXLSX
+{
+    constexpr size_t XLMaxNumberChars = 32;    // buffer size for XLNumberCodec::format, including the terminating zero
+
+    /**
+     * @brief The XLNumberCodec class converts the numeric values of cells to and from the text of their \<v\> nodes.
+     * @details Doubles are written in the shortest form that reads back to the identical value, using std::to_chars where the
+     * standard library supports it for floating point values (CHARCONV_FLOAT_ENABLED). Whole numbers below 1e17 are written
+     * without exponent, like "%.17g" would write them. Parsing uses std::from_chars and, like pugixml, skips leading whitespace,
+     * accepts a leading '+' and returns 0 for text that is not a number. Neither direction depends on the C locale.
+     */
+    class OPENXLSX_EXPORT XLNumberCodec
+    {
+    public:
+        /**
+         * @brief Write a double in its shortest round-trip representation.
+         * @param value The value to write.
+         * @param buffer The target buffer, at least XLMaxNumberChars in size.
+         * @return The length of the written (zero-terminated) text.
+         */
+        static size_t format(double value, char* buffer);
+
+        /**
+         * @brief Write an integer.
+         * @param value The value to write.
+         * @param buffer The target buffer, at least XLMaxNumberChars in size.
+         * @return The length of the written (zero-terminated) text.
+         */
+        static size_t format(int64_t value, char* buffer);
+
+        /**
+         * @brief Determine whether the text of a \<v\> node is a floating point number rather than an integer.
+         * @param str The zero-terminated text.
+         * @return true if str contains a decimal point or an exponent.
+         */
+        static bool isFloatingPoint(const char* str);
+
+        /**
+         * @brief Parse the text of a \<v\> node as a double.
+         * @param str The zero-terminated text.
+         * @return The value, or 0.0 if str is not a number.
+         */
+        static double parseDouble(const char* str);
+
+        /**
+         * @brief Parse the text of a \<v\> node as an integer.
+         * @param str The zero-terminated text.
+         * @return The value, saturated to the int64_t range, or 0 if str is not a number.
+         */
+        static int64_t parseInteger(const char* str);
+    };
+}    // namespace OpenXLSX
+
+#endif    // OPENXLSX_XLNUMBERCODEC_HPP
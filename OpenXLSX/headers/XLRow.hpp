@@ -88,8 +88,9 @@ namespace OpenXLSX
          * @brief
          * @param rowNode
          * @param sharedStrings
+         * @param sheetBounds (optional) the column extent of the parent worksheet, to be updated when cells are created or deleted
          */
-        XLRow(const XMLNode& rowNode, const XLSharedStrings& sharedStrings);
+        XLRow(const XMLNode& rowNode, const XLSharedStrings& sharedStrings, XLSheetBounds* sheetBounds = nullptr);
 
         /**
          * @brief Copy Constructor
@@ -263,10 +264,16 @@ namespace OpenXLSX
          */
         static bool isLessThan(const XLRow& lhs, const XLRow& rhs);
 
+        /**
+         * @brief Record a modification of the row in the parent worksheet, if known, see XLSheetBounds::markModified
+         */
+        void markModified() const;
+
         //---------- PRIVATE MEMBER VARIABLES ----------//
-        std::unique_ptr<XMLNode> m_rowNode;       /**< The XMLNode object for the row. */
-        XLSharedStringsRef       m_sharedStrings; /**< */
-        XLRowDataProxy           m_rowDataProxy;  /**< */
+        XMLNodeStorage     m_rowNode;       /**< The XMLNode object for the row, held inline to avoid an allocation per row. */
+        XLSharedStringsRef m_sharedStrings; /**< */
+        XLRowDataProxy     m_rowDataProxy;  /**< */
+        XLSheetBoundsRef   m_sheetBounds {nullptr}; /**< The column extent of the parent worksheet, if known */
     };
 
     /**
@@ -399,15 +406,16 @@ namespace OpenXLSX
         constexpr XLIteratorDirection direction() const { return XLIteratorDirection::Forward; }
 
     private:
-        std::unique_ptr<XMLNode> m_dataNode;       /**< */
+        XMLNodeStorage           m_dataNode;       /**< */
         uint32_t                 m_firstRow { 1 }; /**< The cell reference of the first cell in the range */
         uint32_t                 m_lastRow { 1 };  /**< The cell reference of the last cell in the range */
         XLRow                    m_currentRow;     /**< */
         XLSharedStringsRef       m_sharedStrings;  /**< */
+        XLSheetBoundsRef         m_sheetBounds;    /**< the column extent of the parent worksheet, if known */
 
         // helper variables for non-creating iterator functionality
         bool                     m_endReached;           /**< */
-        std::unique_ptr<XMLNode> m_hintRow;              /**< The cell node of the last existing row found up to current iterator position */
+        XMLNodeStorage           m_hintRow;              /**< The cell node of the last existing row found up to current iterator position */
         uint32_t                 m_hintRowNumber;        /**<   the row number for m_hintRow */
         static constexpr const int XLNotLoaded  = 0;    // code readability for m_currentRowStatus
         static constexpr const int XLNoSuchRow  = 1;    //   "
@@ -546,15 +554,16 @@ namespace OpenXLSX
         constexpr XLIteratorDirection direction() const { return XLIteratorDirection::Reverse; }
 
     private:
-        std::unique_ptr<XMLNode> m_dataNode;       /**< */
+        XMLNodeStorage           m_dataNode;       /**< */
         uint32_t                 m_firstRow { 1 }; /**< The cell reference of the first cell in the range */
         uint32_t                 m_lastRow { 1 };  /**< The cell reference of the last cell in the range */
         XLRow                    m_currentRow;     /**< */
         XLSharedStringsRef       m_sharedStrings;  /**< */
+        XLSheetBoundsRef         m_sheetBounds;    /**< the column extent of the parent worksheet, if known */
 
         // helper variables for non-creating iterator functionality
         bool                     m_endReached;           /**< */
-        std::unique_ptr<XMLNode> m_hintRow;              /**< The cell node of the last existing row found up to current iterator position */
+        XMLNodeStorage           m_hintRow;              /**< The cell node of the last existing row found up to current iterator position */
         uint32_t                 m_hintRowNumber;        /**<   the row number for m_hintRow */
         static constexpr const int XLNotLoaded  = 0;    // code readability for m_currentRowStatus
         static constexpr const int XLNoSuchRow  = 1;    //   "
@@ -584,8 +593,10 @@ namespace OpenXLSX
          * @param first
          * @param last
          * @param sharedStrings
+         * @param sheetBounds (optional) the column extent of the parent worksheet, passed on to the rows
          */
-        explicit XLRowRange(const XMLNode& dataNode, uint32_t first, uint32_t last, const XLSharedStrings& sharedStrings);
+        explicit XLRowRange(const XMLNode& dataNode, uint32_t first, uint32_t last, const XLSharedStrings& sharedStrings,
+                            XLSheetBounds* sheetBounds = nullptr);
 
         /**
          * @brief copy constructor
@@ -653,10 +664,11 @@ namespace OpenXLSX
         //----------------------------------------------------------------------------------------------------------------------
 
     private:
-        std::unique_ptr<XMLNode> m_dataNode;      /**< */
+        XMLNodeStorage           m_dataNode;      /**< */
         uint32_t                 m_firstRow;      /**< The cell reference of the first cell in the range */
         uint32_t                 m_lastRow;       /**< The cell reference of the last cell in the range */
         XLSharedStringsRef       m_sharedStrings; /**< */
+        XLSheetBoundsRef         m_sheetBounds;   /**< the column extent of the parent worksheet, if known */
     };
 
 }    // namespace OpenXLSX
@@ -678,7 +690,7 @@ namespace OpenXLSX
      * @param rhs
      * @return
      */
-    inline bool operator!=(const XLRow& lhs, const XLRow& rhs) { return !(lhs.m_rowNode == rhs.m_rowNode); }
+    inline bool operator!=(const XLRow& lhs, const XLRow& rhs) { return !XLRow::isEqual(lhs, rhs); }
 
     /**
      * @brief
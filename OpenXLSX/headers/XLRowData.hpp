@@ -124,9 +124,11 @@ namespace OpenXLSX
          */
         XLRowDataIterator(const XLRowDataRange& rowDataRange, XLIteratorLocation loc);
 
-        std::unique_ptr<XLRowDataRange> m_dataRange;   /**< A pointer to the range to iterate over. */
-        std::unique_ptr<XMLNode>        m_cellNode;    /**< The XML node representing the cell currently pointed at. */
-        XLCell                          m_currentCell; /**< The XLCell currently pointed at. */
+        XMLNodeStorage     m_rowNode;       /**< The XML node of the row of the range to iterate over. */
+        uint16_t           m_lastCol;       /**< The last column of the range to iterate over. */
+        XLSharedStringsRef m_sharedStrings; /**< */
+        XLSheetBoundsRef   m_sheetBounds;   /**< The column extent of the parent worksheet, if known. */
+        XLCell             m_currentCell;   /**< The XLCell currently pointed at. */
     };
 
     /**
@@ -150,9 +152,14 @@ namespace OpenXLSX
          * @param firstColumn The index of the first column.
          * @param lastColumn The index of the last column.
          * @param sharedStrings A pointer to the shared strings repository.
+         * @param sheetBounds (optional) The column extent of the parent worksheet, to be updated when iterating creates cells.
          * @throws XLOverflowError if firstColumn > lastColumn
          */
-        explicit XLRowDataRange(const XMLNode& rowNode, uint16_t firstColumn, uint16_t lastColumn, const XLSharedStrings& sharedStrings);
+        explicit XLRowDataRange(const XMLNode&         rowNode,
+                                uint16_t               firstColumn,
+                                uint16_t               lastColumn,
+                                const XLSharedStrings& sharedStrings,
+                                XLSheetBounds*         sheetBounds = nullptr);
 
     public:
         /**
@@ -224,10 +231,11 @@ namespace OpenXLSX
         }
 
     private:
-        std::unique_ptr<XMLNode> m_rowNode;        /**< */
+        XMLNodeStorage           m_rowNode;        /**< */
         uint16_t                 m_firstCol { 1 }; /**< The cell reference of the first cell in the range */
         uint16_t                 m_lastCol { 1 };  /**< The cell reference of the last cell in the range */
         XLSharedStringsRef       m_sharedStrings;  /**< */
+        XLSheetBoundsRef         m_sheetBounds { nullptr }; /**< The column extent of the parent worksheet, if known */
     };
 
     /**
@@ -336,7 +344,7 @@ namespace OpenXLSX
 
             // ===== If the container value_type is a POD type, use the overloaded operator= on each cell.
             else {
-                auto range = XLRowDataRange(*m_rowNode, 1, values.size(), getSharedStrings());
+                auto range = XLRowDataRange(*m_rowNode, 1, values.size(), getSharedStrings(), getSheetBounds());
                 auto dst   = range.begin();    // 2024-04-30: whitespace support: safe because XLRowDataRange::begin invokes whitespace-safe
                                                // getCellNode for column 1
                 auto src = values.begin();
@@ -428,6 +436,13 @@ namespace OpenXLSX
          */
         const XLSharedStrings& getSharedStrings() const;
 
+        /**
+         * @brief Helper function for getting the column extent of the parent worksheet.
+         * @return A pointer to the XLSheetBounds object, or nullptr if the row was not obtained from a worksheet.
+         * @note needed for templated XLRowDataProxy& operator=
+         */
+        XLSheetBounds* getSheetBounds() const;
+
         /**
          * @brief Convenience function for erasing the first 'count' numbers of values in the row.
          * @param count The number of values to erase.
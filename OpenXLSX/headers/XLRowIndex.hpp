@@ -0,0 +1,143 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+#ifndef OPENXLSX_XLROWINDEX_HPP
+#define OPENXLSX_XLROWINDEX_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <cstdint>    // uint32_t
+#include <map>
+
+// ===== OpenXLSX Includes ===== //
+#include "OpenXLSX-Exports.hpp"
+#include "XLXmlParser.hpp"
+
+namespace OpenXLSX
+{
+    /**
+     * @brief The XLRowIndex class maps row numbers to the row nodes of a worksheet's sheetData node, so that random access to a
+     * row does not have to walk the row siblings.
+     * @details The index is an ordered map from row number to row node, built on first use and updated by the rows created and
+     * deleted through it. Being ordered, it also yields the nearest indexed rows around a missing row in logarithmic time. Rows
+     * created elsewhere (e.g. by the row and cell iterators) are picked up when a lookup misses: the XML is then searched from the
+     * nearest indexed row, and the rows passed on the way are added to the index.
+     * @warning Row nodes must not be removed from sheetData other than through deleteRow, as the index would keep a dangling node.
+     */
+    class OPENXLSX_EXPORT XLRowIndex
+    {
+    public:
+        /**
+         * @brief Find an existing row.
+         * @param sheetDataNode The sheetData node of the worksheet.
+         * @param rowNumber The number of the row to find.
+         * @return The row node, or an empty XMLNode if the row does not exist.
+         * @throw XLCellAddressError if rowNumber is outside the valid range.
+         */
+        XMLNode findRow(XMLNode sheetDataNode, uint32_t rowNumber);
+
+        /**
+         * @brief Find the first existing row at or after a row number, e.g. to walk the rows of a range.
+         * @param sheetDataNode The sheetData node of the worksheet.
+         * @param rowNumber The row number to start at.
+         * @return The row node, or an empty XMLNode if no row at or after rowNumber exists.
+         * @throw XLCellAddressError if rowNumber is outside the valid range.
+         */
+        XMLNode lowerBound(XMLNode sheetDataNode, uint32_t rowNumber);
+
+        /**
+         * @brief Get a row, creating the row node at its ordered position if it does not exist.
+         * @param sheetDataNode The sheetData node of the worksheet.
+         * @param rowNumber The number of the row to get.
+         * @return The row node.
+         * @throw XLCellAddressError if rowNumber is outside the valid range.
+         */
+        XMLNode getRow(XMLNode sheetDataNode, uint32_t rowNumber);
+
+        /**
+         * @brief Delete a row node from sheetData and from the index.
+         * @param sheetDataNode The sheetData node of the worksheet.
+         * @param rowNumber The number of the row to delete.
+         * @return true if the row existed and was deleted, otherwise false.
+         */
+        bool deleteRow(XMLNode sheetDataNode, uint32_t rowNumber);
+
+        /**
+         * @brief Discard the index, e.g. when the XML document has been replaced. It is rebuilt on next use.
+         */
+        void clear();
+
+    private:
+        /**
+         * @brief (Re)build the index if it has not been built for sheetDataNode.
+         */
+        void update(XMLNode sheetDataNode);
+
+        /**
+         * @brief Add a row node to the index.
+         */
+        void insert(uint32_t rowNumber, const pugi::xml_node& rowNode);
+
+        /**
+         * @brief Locate the row with the highest row number not exceeding rowNumber.
+         * @return The row node, or an empty XMLNode if all rows have a higher row number.
+         */
+        XMLNode locate(XMLNode sheetDataNode, uint32_t rowNumber);
+
+        pugi::xml_node                     m_sheetDataNode {}; /**< the sheetData node the index has been built for */
+        std::map<uint32_t, pugi::xml_node> m_rows {};          /**< the indexed row nodes by row number */
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLROWINDEX_HPP
@@ -52,14 +52,19 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #   pragma warning(disable : 4275)
 #endif // _MSC_VER
 
-#include <deque>
+#include <cstdint>    // uint8_t
 #include <functional> // std::reference_wrapper
 #include <limits>     // std::numeric_limits
 #include <ostream>    // std::basic_ostream
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
+#include "XLStringArena.hpp"
+#include "XLXmlData.hpp"    // XLXmlSavingDeclaration
 #include "XLXmlFile.hpp"
 
 namespace OpenXLSX
@@ -67,8 +72,46 @@ namespace OpenXLSX
     constexpr size_t XLMaxSharedStrings = (std::numeric_limits< int32_t >::max)();    // pull request #261: wrapped max in parentheses to prevent expansion of windows.h "max" macro
 
     class XLSharedStrings; // forward declaration
+    class XLZipEntryWriter;
+
+    /**
+     * @brief How string cell values are stored, see XLStringWritePolicy
+     */
+    enum class XLStringWriteMode : uint8_t {
+        SharedStrings,    /**< store all strings in the shared strings table (t="s") - default */
+        InlineStrings,    /**< store all strings in the cell (t="inlineStr") */
+        Adaptive          /**< reuse strings that are in the shared strings table, store new strings inline if they are long or the
+                           *   table has reached its cardinality threshold */
+    };
+
+    /**
+     * @brief The string write policy of a document, see XLDocument::setStringWritePolicy
+     * @note inline strings avoid the shared strings lookup & growth for values that are never repeated, e.g. UUIDs or free text
+     */
+    struct XLStringWritePolicy
+    {
+        XLStringWriteMode mode {XLStringWriteMode::SharedStrings}; /**< the mode - the thresholds only apply to Adaptive */
+        size_t inlineMinLength {64};                               /**< new strings of at least this length are stored inline */
+        size_t maxSharedStrings {XLMaxSharedStrings};              /**< once the table holds this many strings, new strings are stored inline */
+    };
     typedef std::reference_wrapper< const XLSharedStrings > XLSharedStringsRef;
 
+    /**
+     * @brief hash index into the shared strings cache: string content -> shared string index
+     * @note the std::string_view keys point into the XLStringArena owned by XLDocument, which guarantees stable string addresses
+     */
+    typedef std::unordered_map< std::string_view, int32_t > XLSharedStringIndex;
+
+    constexpr uint32_t XLUnknownReferenceCount = (std::numeric_limits< uint32_t >::max)(); // reference count of a shared string whose
+                                                                                             //  references have not been counted
+
+    /**
+     * @brief reference counts of the shared strings: the amount of cells referencing each shared string index
+     * @note strings read from a file are XLUnknownReferenceCount until all references are counted, by
+     *  XLDocument::cleanupSharedStrings, or on save after a cell released a reference to such a string
+     */
+    typedef std::vector< uint32_t > XLSharedStringRefCounts;
+
     extern const XLSharedStrings XLSharedStringsDefaulted; // to be used for default initialization of all references of type XLSharedStrings
 
     /**
@@ -79,7 +122,11 @@ namespace OpenXLSX
     class OPENXLSX_EXPORT XLSharedStrings : public XLXmlFile
     {
         //---------- Friend Declarations ----------//
-        friend class XLDocument; // for access to protected function rewriteXmlFromCache
+        friend class XLDocument;       // for access to protected functions rewriteXmlFromCache, writeXmlFromCache & releaseUnusedStrings
+        friend class XLCell;           // for access to protected functions retainString & releaseString
+        friend class XLCellValueProxy; //  "
+        friend class XLStreamWriter;   //  "
+        friend class XLWorksheet;      //  "
 
         //----------------------------------------------------------------------------------------------------------------------
         //           Public Member Functions
@@ -95,8 +142,15 @@ namespace OpenXLSX
          * @brief
          * @param xmlData
          * @param stringCache
+         * @param stringIndex optional hash index for constant time string lookup, built from stringCache on first lookup
+         * @param refCounts optional reference counts, maintained in parallel to stringCache
+         * @note the XML document is not accessed until the shared strings are modified, so that a shared strings table that is
+         *       only read is never parsed into a DOM
          */
-        explicit XLSharedStrings(XLXmlData* xmlData, std::deque<std::string>* stringCache);
+        explicit XLSharedStrings(XLXmlData* xmlData,
+                                 XLStringArena* stringCache,
+                                 XLSharedStringIndex* stringIndex = nullptr,
+                                 XLSharedStringRefCounts* refCounts = nullptr);
 
         /**
          * @brief Copy constructor
@@ -160,12 +214,37 @@ namespace OpenXLSX
          * @brief Append a new string to the list of shared strings.
          * @param str The string to append.
          * @return An int32_t with the index of the appended string
+         * @throw XLException if the document was opened read-only
          */
         int32_t appendString(const std::string& str) const;
 
+        /**
+         * @brief Look up a string and append it to the shared strings if it does not exist yet.
+         * @param str The string to look up or append.
+         * @return An int32_t with the index of the existing or appended string
+         * @throw XLException if str has to be appended and the document was opened read-only
+         * @note unlike stringExists + getStringIndex + appendString, this hashes str only once
+         */
+        int32_t getOrAppendString(const std::string& str) const;
+
+        /**
+         * @brief Look up or append a string as the string write policy of the document demands.
+         * @param str The string to store.
+         * @return An int32_t with the index of the existing or appended string, or -1 if the string is to be stored inline
+         */
+        int32_t getOrAppendStringByPolicy(const std::string& str) const;
+
+        /**
+         * @brief Get the amount of cells referencing a shared string.
+         * @param index The index of the string.
+         * @return The reference count, XLUnknownReferenceCount if the references have not been counted (or are not tracked)
+         */
+        uint32_t referenceCount(int32_t index) const;
+
         /**
          * @brief Clear the string at the given index.
          * @param index The index to clear.
+         * @throw XLException if the document was opened read-only
          * @note There is no 'deleteString' member function, as deleting a shared string node will invalidate the
          * shared string indices for the cells in the spreadsheet. Instead use this member functions, which clears
          * the contents of the string, but keeps the XMLNode holding the string.
@@ -189,11 +268,78 @@ namespace OpenXLSX
         /**
          * @brief clear & rewrite the full shared strings XML from the shared strings cache
          * @return the amount of strings written to XML (should be equal to m_stringCache->size())
+         * @note if the document defers the shared strings XML, only the hash index is rebuilt & the XML is flagged as outdated
          */
         int32_t rewriteXmlFromCache();
 
+        /**
+         * @brief write the full shared strings XML from the shared strings cache to an archive entry, without building a DOM
+         * @param entry the archive entry to write to - it is not committed
+         * @param savingDeclaration the XML declaration to write
+         * @return the amount of strings written
+         */
+        int32_t writeXmlFromCache(XLZipEntryWriter& entry, const XLXmlSavingDeclaration& savingDeclaration) const;
+
+        /**
+         * @brief add a cell reference to a shared string
+         * @param index The index of the string - ignored if out of range
+         */
+        void retainString(int32_t index) const;
+
+        /**
+         * @brief remove a cell reference from a shared string - an unreferenced string is released by releaseUnusedStrings
+         * @param index The index of the string - ignored if out of range
+         * @note if the references to the string have not been counted, the document counts the references to all strings on save
+         */
+        void releaseString(int32_t index) const;
+
+        /**
+         * @brief flag the references to all strings as unknown, e.g. after cells were copied without retainString
+         */
+        void forgetReferenceCounts() const;
+
+        /**
+         * @brief release the unreferenced strings: their contents are cleared, and unreferenced strings at the end of the table
+         *  are removed. Strings keep their index, so that no cell needs to be updated, and the XML of the other strings is kept.
+         * @return the amount of released strings
+         * @note the time taken is proportional to the size of the shared strings table, not to the number of cells
+         */
+        int32_t releaseUnusedStrings();
+
     private:
-        std::deque<std::string>* m_stringCache {}; /** < Each string must have an unchanging memory address; hence the use of std::deque */
+        /**
+         * @brief clear & rebuild m_stringIndex from m_stringCache - for duplicate strings, the lowest index is kept
+         */
+        void rebuildStringIndex() const;
+
+        /**
+         * @brief build m_stringIndex if it has not been built yet - this decodes all strings
+         * @note must be called before any m_stringIndex update, which relies on a complete index
+         */
+        void ensureStringIndex() const;
+
+        /**
+         * @brief check if the document defers the shared strings XML until saving, and if so, flag the XML as outdated
+         * @return true if a change must only be applied to m_stringCache, not to the XML
+         */
+        bool deferXmlUpdate() const;
+
+        /**
+         * @brief throw if the document was opened read-only, see XLOpenOptions::readOnly
+         * @param function the name of the rejected function, for the exception message
+         * @throw XLException if the document is read-only
+         */
+        void rejectIfReadOnly(const char* function) const;
+
+        /**
+         * @brief get the sst document element to modify, creating a default document for a bad (no document element) xl/sharedStrings.xml
+         * @return the sst node
+         */
+        XMLNode sstNode() const;
+
+        XLStringArena*           m_stringCache {}; /** < Each string must have an unchanging memory address; hence the use of XLStringArena */
+        XLSharedStringIndex*     m_stringIndex {}; /** < if not nullptr: hash index into m_stringCache, owned by XLDocument */
+        XLSharedStringRefCounts* m_refCounts {};   /** < if not nullptr: reference counts of m_stringCache, owned by XLDocument */
     };
 }    // namespace OpenXLSX
 
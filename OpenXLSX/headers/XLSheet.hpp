@@ -963,6 +963,66 @@ namespace OpenXLSX
          */
         XLCellAssignable findCell(uint32_t rowNumber, uint16_t columnNumber) const;
 
+        /**
+         * @brief Find the existing cells of a row in a column range, in one pass over the row. Do *not* create row & cell XML if missing.
+         * @param rowNumber The row number (index base 1).
+         * @param firstColumn The first column of the range.
+         * @param count The number of columns in the range.
+         * @param cells Receives the cell of column firstColumn + i at cells[i] - an empty XLCell if the cell does not exist.
+         * @throw XLCellAddressError if the row or the column range is invalid.
+         */
+        void findCells(uint32_t rowNumber, uint16_t firstColumn, uint16_t count, XLCell* cells) const;
+
+        /**
+         * @brief Read the values of a column into a contiguous buffer, without creating XLCell or XLCellValue objects.
+         * @tparam T double, int64_t or bool
+         * @param column The column number (index base 1).
+         * @param firstRow The first row to read.
+         * @param lastRow The last row to read.
+         * @param out Buffer for lastRow - firstRow + 1 values: out[i] receives the value of row firstRow + i.
+         * @param validity Optional bitmap of (lastRow - firstRow + 8) / 8 bytes: bit (i % 8) of validity[i / 8] is set if out[i] holds
+         *  a value, and cleared if the cell does not exist or does not hold a value of type T (out[i] is then T{}).
+         * @return The number of valid values.
+         * @note double accepts integer and floating point cells, int64_t only integer cells and bool only boolean cells. Formula
+         *  cells provide their cached value. Rows and cells are not created.
+         * @throw XLCellAddressError if the column or row range is invalid.
+         */
+        template<typename T>
+        size_t readColumn(uint16_t column, uint32_t firstRow, uint32_t lastRow, T* out, uint8_t* validity = nullptr) const
+        {
+            return readColumns<T>({ column }, firstRow, lastRow, &out, validity == nullptr ? nullptr : &validity);
+        }
+
+        /**
+         * @brief Read the values of several columns into one buffer per column (struct of arrays), walking the rows only once.
+         * @tparam T double, int64_t or bool
+         * @param columns The column numbers, in any order.
+         * @param firstRow The first row to read.
+         * @param lastRow The last row to read.
+         * @param out out[k] is the buffer for columns[k], see readColumn.
+         * @param validity Optional: validity[k] is the validity bitmap for columns[k], see readColumn.
+         * @return The number of valid values in all columns.
+         * @throw XLCellAddressError if a column or the row range is invalid.
+         */
+        template<typename T>
+        size_t readColumns(const std::vector<uint16_t>& columns, uint32_t firstRow, uint32_t lastRow, T* const* out,
+                           uint8_t* const* validity = nullptr) const;
+
+        /**
+         * @brief Write a block of values from a contiguous (row major) array in a single ordered pass over rows and cells.
+         * @tparam T double, int64_t, bool or std::string
+         * @param topLeft The top left cell of the block.
+         * @param rows The number of rows in the block.
+         * @param cols The number of columns in the block.
+         * @param data The values: the value for row r and column c of the block is data[r * stride + c].
+         * @param stride The distance between the first values of consecutive rows in data, 0 for cols.
+         * @note Cells that do not exist yet are created and written directly. Existing cells are assigned through XLCellValueProxy,
+         *  which removes their previous value. Strings are written as shared or inline strings according to the string write policy.
+         * @throw XLCellAddressError if the block exceeds the worksheet bounds.
+         */
+        template<typename T>
+        void writeBlock(const XLCellReference& topLeft, uint32_t rows, uint16_t cols, const T* data, size_t stride = 0);
+
         /**
          * @brief Set the worksheet's <dimension> tag, attribute ref
          * @param topLeft top left cell for the dimension tag. If left empty, will use A1
@@ -970,7 +1030,9 @@ namespace OpenXLSX
          * @param autoCalculateLastCell if false, disables auto-calculation of last cell for bottomRight
          * @note if bottomRight is "A1", invoke lastCell to determine dimension range - can be disabled by passing XLDoNotCalculateLastCell for autoCalculateLastCell
          * @note serves as root function for two overloads
-         * @warning for now, invoking a new XLWorksheet constructor will delete the <dimension> tag again (preferring no tag over a wrong one). This function should only be invoked directly before a save operation.
+         * @note XLDocument sets the dimension of each modified worksheet to A1:lastCell() on save, unless a dimension was set here
+         *  without auto-calculation of the last cell: such a dimension is kept, even if cells are created outside of it later.
+         *  Call setDimension() without arguments to return to the automatic dimension.
          * @return
          */
         void setDimension(XLCellReference topLeft = XLCellReference("A1"), XLCellReference bottomRight = XLCellReference{}, bool autoCalculateLastCell = XLCalculateLastCell);
@@ -980,7 +1042,7 @@ namespace OpenXLSX
          * @param topLeft address of the top left cell for dimension
          * @param bottomRight address of the bottom right cell for dimension
          * @note as in the root setDimension function, providing "A1" for bottomRight invokes auto-calculation of last cell
-         * @warning see root setDimension function
+         * @note see root setDimension function
          * @return
          */
         void setDimension(std::string topLeft, std::string bottomRight);
@@ -989,7 +1051,7 @@ namespace OpenXLSX
          * @brief overload for setDimension(XLCellReference topLeft, XLCellReference bottomRight)
          * @param dimension range address to use as dimension
          * @note while setting "A1:A1" still allows auto-calculation of last cell, this overload also allows setting a *single* dimension "A1", by invoking the root setDimension function with XLDoNotCalculateLastCell
-         * @warning see root setDimension function
+         * @note see root setDimension function
          * @return
          */
         void setDimension(std::string dimension);
@@ -1074,7 +1136,8 @@ namespace OpenXLSX
 
         /**
          * @brief Get the number of columns in the worksheet.
-         * @return The number of columns.
+         * @return The number of columns, i.e. the highest column number of any cell.
+         * @note the column extent is cached and maintained as cells are created and rows are deleted, see XLSheetBounds
          */
         uint16_t columnCount() const noexcept;
 
@@ -1356,6 +1419,17 @@ namespace OpenXLSX
         const std::vector< std::string_view >& m_nodeOrder = XLWorksheetNodeOrder;  // worksheet XML root node required child sequence
     };
 
+    // ===== XLWorksheet::readColumns is instantiated in XLSheet.cpp for the supported value types
+    extern template size_t XLWorksheet::readColumns<double>(const std::vector<uint16_t>&, uint32_t, uint32_t, double* const*, uint8_t* const*) const;
+    extern template size_t XLWorksheet::readColumns<int64_t>(const std::vector<uint16_t>&, uint32_t, uint32_t, int64_t* const*, uint8_t* const*) const;
+    extern template size_t XLWorksheet::readColumns<bool>(const std::vector<uint16_t>&, uint32_t, uint32_t, bool* const*, uint8_t* const*) const;
+
+    // ===== XLWorksheet::writeBlock is instantiated in XLSheet.cpp for the supported value types
+    extern template void XLWorksheet::writeBlock<double>(const XLCellReference&, uint32_t, uint16_t, const double*, size_t);
+    extern template void XLWorksheet::writeBlock<int64_t>(const XLCellReference&, uint32_t, uint16_t, const int64_t*, size_t);
+    extern template void XLWorksheet::writeBlock<bool>(const XLCellReference&, uint32_t, uint16_t, const bool*, size_t);
+    extern template void XLWorksheet::writeBlock<std::string>(const XLCellReference&, uint32_t, uint16_t, const std::string*, size_t);
+
     /**
      * @brief Class representing the an Excel chartsheet.
      * @todo This class is largely unimplemented and works just as a placeholder.
@@ -0,0 +1,254 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+#ifndef OPENXLSX_XLSHEETBOUNDS_HPP
+#define OPENXLSX_XLSHEETBOUNDS_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <cstdint>    // uint16_t
+
+// ===== OpenXLSX Includes ===== //
+#include "OpenXLSX-Exports.hpp"
+#include "XLXmlParserForwardDeclarations.hpp"
+
+namespace OpenXLSX
+{
+    /**
+     * @brief The XLSheetBounds class caches the column extent of a worksheet, i.e. the highest column number of any cell, so that
+     * XLWorksheet::columnCount and lastCell do not have to visit every row.
+     * @details The row extent needs no cache: rows are stored in ascending order, so the last row node holds the highest row number.
+     * The column extent is determined on first use from the last cell of each row. The <dimension> tag is not read, as it may
+     * have been written by another producer; the library only writes it on save (see hasExplicitDimension). Once determined, the
+     * extent is kept up to date by the library functions that create or delete cells: extend for every created cell, shrink for
+     * deleted rows. A shrink that may remove the widest row causes the extent to be determined again from the XML on next use.
+     * The same functions, and the setters of cells and rows, also record that the worksheet was modified (see XLXmlData::isDirty):
+     * a read leaves the XML document unchanged, so that a worksheet that was only read is copied as-is on save.
+     * @warning Cells created or modified through objects that were not obtained from an XLWorksheet (e.g. an XLCellRange or XLRow
+     * constructed directly from an XMLNode) are tracked neither for the column extent nor as a modification.
+     */
+    class OPENXLSX_EXPORT XLSheetBounds
+    {
+    public:
+        /**
+         * @brief Get the highest column number of any cell in the worksheet.
+         * @param sheetDataNode The sheetData node of the worksheet.
+         * @return The column number, or 0 if the worksheet has no cells.
+         */
+        uint16_t lastColumn(XMLNode sheetDataNode);
+
+        /**
+         * @brief Record that a cell was created.
+         * @param column The column number of the new cell.
+         */
+        void extend(uint16_t column)
+        {
+            if (column > m_lastColumn) m_lastColumn = column;
+            m_modified = true;
+        }
+
+        /**
+         * @brief Record that a cell may have been created, by a function that creates missing cells.
+         * @param column The column number of the cell.
+         * @param cellNode The cell node. A created cell node has no child nodes yet, so only such a node counts as a modification.
+         */
+        void extend(uint16_t column, const XMLNode& cellNode);
+
+        /**
+         * @brief Record that cells were deleted.
+         * @param column The highest column number of the deleted cells.
+         */
+        void shrink(uint16_t column);
+
+        /**
+         * @brief Record that the worksheet was modified other than by creating or deleting cells.
+         */
+        void markModified() { m_modified = true; }
+
+        /**
+         * @brief Test whether the worksheet was modified since the last call to clearModified.
+         * @return true if extend, shrink or markModified recorded a modification, otherwise false
+         */
+        bool isModified() const { return m_modified; }
+
+        /**
+         * @brief Forget recorded modifications, e.g. when the worksheet has been written to the archive.
+         */
+        void clearModified() { m_modified = false; }
+
+        /**
+         * @brief Discard the cached extent, e.g. when the XML document has been replaced. It is determined again on next use.
+         */
+        void clear();
+
+        /**
+         * @brief Record whether the <dimension> tag was set explicitly, see XLWorksheet::setDimension.
+         * @param explicitDimension true if the dimension was set by the user, false if it is to be determined on save
+         */
+        void setExplicitDimension(bool explicitDimension) { m_explicitDimension = explicitDimension; }
+
+        /**
+         * @brief Test whether the <dimension> tag was set explicitly - if so, saving does not replace it with A1:lastCell().
+         * @return true if the dimension was set by the user, otherwise false
+         */
+        bool hasExplicitDimension() const { return m_explicitDimension; }
+
+        /**
+         * @brief Test whether cell, row or range objects into the worksheet are alive, see XLSheetBoundsRef.
+         * @return true if an XLSheetBoundsRef other than the one held by the XLXmlData of the worksheet refers to this object
+         * @note the memory budget does not evict a pinned worksheet, as the XML nodes held by those objects would be destroyed
+         */
+        bool isPinned() const { return m_refs > 1; }
+
+    private:
+        friend class XLSheetBoundsRef;
+
+        uint16_t m_lastColumn {0};    /**< the column extent if m_known */
+        bool     m_known {false};     /**< true if m_lastColumn is the exact column extent */
+        bool     m_modified {false};  /**< true if a modification of the worksheet was recorded, see isModified */
+        bool     m_explicitDimension {false}; /**< true if the <dimension> tag was set by the user, see hasExplicitDimension */
+        uint32_t m_refs {0};          /**< the amount of XLSheetBoundsRef objects referring to this object */
+    };
+
+    /**
+     * @brief The XLSheetBoundsRef class is a reference counted pointer to the XLSheetBounds of a worksheet. It is held by the
+     * XLXmlData of the worksheet, and by XLCell, XLRow, XLCellRange and their iterators, which thereby pin the worksheet: the
+     * memory budget does not evict the XML document that they point into.
+     * @details Behaves like a plain XLSheetBounds pointer, which may be nullptr. The XLSheetBounds is deleted with the last
+     * reference, so that an object that outlives its document can still be destroyed. Unlike std::shared_ptr, the reference count
+     * is not synchronized: like the objects holding it, an XLSheetBoundsRef must only be used by the thread that owns the document.
+     */
+    class OPENXLSX_EXPORT XLSheetBoundsRef
+    {
+    public:
+        /**
+         * @brief Constructor
+         * @param sheetBounds An XLSheetBounds allocated with new, or one that is referred to by another XLSheetBoundsRef,
+         *  or nullptr
+         */
+        XLSheetBoundsRef(XLSheetBounds* sheetBounds = nullptr) : m_sheetBounds(sheetBounds) { acquire(); }    // NOLINT
+
+        /**
+         * @brief Copy constructor
+         * @param other The object to copy
+         */
+        XLSheetBoundsRef(const XLSheetBoundsRef& other) : m_sheetBounds(other.m_sheetBounds) { acquire(); }
+
+        /**
+         * @brief Move constructor
+         * @param other The object to move - it becomes nullptr
+         */
+        XLSheetBoundsRef(XLSheetBoundsRef&& other) noexcept : m_sheetBounds(other.m_sheetBounds) { other.m_sheetBounds = nullptr; }
+
+        /**
+         * @brief Destructor
+         */
+        ~XLSheetBoundsRef() { release(); }
+
+        /**
+         * @brief Copy assignment operator
+         * @param other The object to copy
+         * @return A reference to this object
+         */
+        XLSheetBoundsRef& operator=(const XLSheetBoundsRef& other)
+        {
+            if (other.m_sheetBounds != m_sheetBounds) {
+                release();
+                m_sheetBounds = other.m_sheetBounds;
+                acquire();
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Move assignment operator
+         * @param other The object to move - it becomes nullptr
+         * @return A reference to this object
+         */
+        XLSheetBoundsRef& operator=(XLSheetBoundsRef&& other) noexcept
+        {
+            if (&other != this) {
+                release();
+                m_sheetBounds       = other.m_sheetBounds;
+                other.m_sheetBounds = nullptr;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Access the XLSheetBounds, which may be nullptr
+         */
+        operator XLSheetBounds*() const { return m_sheetBounds; }    // NOLINT
+
+        /**
+         * @brief Access a member of the XLSheetBounds, which must not be nullptr
+         */
+        XLSheetBounds* operator->() const { return m_sheetBounds; }
+
+    private:
+        void acquire() const
+        {
+            if (m_sheetBounds != nullptr) ++m_sheetBounds->m_refs;
+        }
+
+        void release() const
+        {
+            if (m_sheetBounds != nullptr && --m_sheetBounds->m_refs == 0) delete m_sheetBounds;
+        }
+
+        XLSheetBounds* m_sheetBounds; /**< the referenced XLSheetBounds, or nullptr */
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLSHEETBOUNDS_HPP
@@ -0,0 +1,229 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+#ifndef OPENXLSX_XLSTREAMREADER_HPP
+#define OPENXLSX_XLSTREAMREADER_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <cstdint>        // uint32_t
+#include <memory>         // std::unique_ptr
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ===== OpenXLSX Includes ===== //
+#include "OpenXLSX-Exports.hpp"
+#include "IZipArchive.hpp"        // XLZipEntryStream
+#include "XLCellValue.hpp"
+#include "XLSharedStrings.hpp"    // XLSharedStringsRef
+
+namespace OpenXLSX
+{
+    class XLXmlData;
+
+    /**
+     * @brief The XLStreamReader class reads the cell values of a worksheet row by row, straight from the (compressed) archive
+     * entry, without building the XML document tree of the worksheet.
+     * @details The worksheet entry is decompressed in chunks as the reader advances, and only the current row is decoded.
+     * Memory consumption is therefore independent of the size of the worksheet, which makes XLStreamReader the tool of choice
+     * to read worksheets that are too large to be loaded with XLWorksheet. The reader is forward-only:
+     * ```cpp
+     * XLStreamReader reader = doc.workbook().streamReader("Sheet1");
+     * while (reader.nextRow()) {
+     *     for (const XLCellValue& value : reader.values()) ...    // values()[0] is column A
+     * }
+     * ```
+     * Shared strings are resolved through the document's XLSharedStrings. If the worksheet has been modified through
+     * XLWorksheet in the meantime, the reader operates on the current (in-memory) XML data instead of the archive entry.
+     * @note Reading a modified worksheet serializes its whole XML document into memory first, so memory consumption is no longer
+     * independent of the size of the worksheet in that case.
+     * @warning An XLStreamReader must not be used after the document has been saved or closed.
+     */
+    class OPENXLSX_EXPORT XLStreamReader
+    {
+        friend class XLWorkbook;
+
+    public:
+        /**
+         * @brief Copy constructor (deleted).
+         */
+        XLStreamReader(const XLStreamReader& other) = delete;
+
+        /**
+         * @brief Move constructor.
+         */
+        XLStreamReader(XLStreamReader&& other) noexcept;
+
+        /**
+         * @brief Destructor.
+         */
+        ~XLStreamReader();
+
+        /**
+         * @brief Copy assignment operator (deleted).
+         */
+        XLStreamReader& operator=(const XLStreamReader& other) = delete;
+
+        /**
+         * @brief Move assignment operator.
+         */
+        XLStreamReader& operator=(XLStreamReader&& other) noexcept;
+
+        /**
+         * @brief Advance to the next row in the worksheet that has an XML entry.
+         * @return true if a row was read, false when the end of the worksheet data has been reached.
+         * @throw XLInputError if the worksheet XML is malformed, or refers to a shared string that does not exist.
+         */
+        bool nextRow();
+
+        /**
+         * @brief Get the (1-based) number of the current row.
+         * @return The row number, 0 before the first call to nextRow.
+         */
+        uint32_t rowNumber() const;
+
+        /**
+         * @brief Get the values of the current row.
+         * @return The cell values, index 0 being column A. The vector ends with the last cell present in the row; columns without a
+         * cell entry are represented by empty values.
+         * @note The returned vector is reused by the next call to nextRow.
+         */
+        const std::vector<XLCellValue>& values() const;
+
+    private:
+        /**
+         * @brief Constructor. Invoked by XLWorkbook::streamReader.
+         * @param xmlData The XLXmlData object of the worksheet to read.
+         */
+        explicit XLStreamReader(XLXmlData* xmlData);
+
+        enum class XLToken : uint8_t { StartTag, EndTag, Text, End };
+
+        /**
+         * @brief Make sure that at least count bytes from the current read position are available in the buffer.
+         * @return false if the end of the entry is reached before count bytes are available.
+         */
+        bool require(size_t count);
+
+        /**
+         * @brief Find a character sequence in the stream, reading more data as needed.
+         * @param pattern The sequence to find.
+         * @param offset The offset from the current read position to start the search at.
+         * @return The offset of pattern from the current read position, std::string_view::npos if the end of the entry is reached.
+         */
+        size_t find(std::string_view pattern, size_t offset);
+
+        /**
+         * @brief Find the closing '>' of the tag at the current read position, ignoring '>' in quoted attribute values.
+         * @return The offset of the closing '>' from the current read position.
+         * @throw XLInputError if the end of the entry is reached first.
+         */
+        size_t tagEnd();
+
+        /**
+         * @brief Parse the next token (tag or text run) from the XML stream. Comments, processing instructions and the document
+         * type declaration are skipped.
+         */
+        XLToken nextToken();
+
+        /**
+         * @brief Skip the content of the element whose start tag has just been read, including its end tag.
+         */
+        void skipElement();
+
+        /**
+         * @brief Read the text content of the element whose start tag has just been read, including its end tag.
+         * @param text Receives the concatenated (decoded) text of the element.
+         */
+        void readElementText(std::string& text);
+
+        /**
+         * @brief Read the text content of an inline string (&lt;is&gt; element), concatenating the text of all rich text runs.
+         * @param text Receives the string.
+         */
+        void readInlineString(std::string& text);
+
+        /**
+         * @brief Decode the cell whose start tag has just been read and store its value in m_values.
+         */
+        void readCell();
+
+        /**
+         * @brief Get the (raw) value of an attribute of the most recently read start tag.
+         * @param name The local name of the attribute.
+         * @return The attribute value, empty if the attribute is not present.
+         */
+        std::string_view attribute(std::string_view name) const;
+
+        std::unique_ptr<XLZipEntryStream> m_stream;                /**< the source of the worksheet XML */
+        XLSharedStringsRef                m_sharedStrings;         /**< the document shared strings, used for cells of type "s" */
+        std::vector<char>                 m_buffer;                /**< the read buffer, holding at least one complete token */
+        size_t                            m_begin {0};             /**< the read position in m_buffer */
+        size_t                            m_end {0};               /**< the end of valid data in m_buffer */
+        bool                              m_eof {false};           /**< true once m_stream has been read completely */
+        std::string_view                  m_name;                  /**< the local name of the most recently read tag */
+        std::string_view                  m_attributes;            /**< the attributes of the most recently read start tag */
+        bool                              m_selfClosing {false};   /**< true if the most recently read start tag was self-closing */
+        std::string                       m_text;                  /**< the decoded content of the most recently read text token */
+        std::string                       m_valueText;             /**< buffer for the value of the current cell */
+        bool                              m_inSheetData {false};   /**< true once the sheetData element has been entered */
+        bool                              m_finished {false};      /**< true once the end of sheetData has been reached */
+        uint32_t                          m_rowNumber {0};         /**< the number of the current row */
+        uint16_t                          m_column {0};            /**< the column number of the most recently read cell */
+        std::vector<XLCellValue>          m_values;                /**< the values of the current row */
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLSTREAMREADER_HPP
@@ -0,0 +1,171 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+#ifndef OPENXLSX_XLSTREAMWRITER_HPP
+#define OPENXLSX_XLSTREAMWRITER_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <cstdint>    // uint32_t
+#include <memory>     // std::unique_ptr
+#include <string>
+#include <vector>
+
+// ===== OpenXLSX Includes ===== //
+#include "OpenXLSX-Exports.hpp"
+#include "IZipArchive.hpp"    // XLZipEntryWriter
+#include "XLCellValue.hpp"
+
+namespace OpenXLSX
+{
+    class XLDocument;
+
+    /**
+     * @brief The XLStreamWriter class creates a new worksheet by appending rows sequentially, serializing each row straight into
+     * the compressed archive entry of the worksheet.
+     * @details No XML document tree is built for the worksheet, so the memory consumption does not depend on the number of rows
+     * written. String values are stored as the string write policy of the document demands, like values assigned through XLCellValueProxy.
+     * The worksheet is added to the workbook (workbook.xml, content types and relationships) when the writer is closed:
+     * ```cpp
+     * XLStreamWriter writer = doc.workbook().streamWriter("Data");
+     * for (...) writer.appendRow({ XLCellValue(1), XLCellValue("text"), XLCellValue(3.14) });    // first value goes to column A
+     * writer.close();
+     * doc.save();
+     * ```
+     * @warning The writer must be closed before the document is saved or closed. A writer that is destroyed without having been
+     * closed discards the worksheet.
+     */
+    class OPENXLSX_EXPORT XLStreamWriter
+    {
+        friend class XLWorkbook;
+
+    public:
+        /**
+         * @brief Copy constructor (deleted).
+         */
+        XLStreamWriter(const XLStreamWriter& other) = delete;
+
+        /**
+         * @brief Move constructor.
+         */
+        XLStreamWriter(XLStreamWriter&& other) noexcept;
+
+        /**
+         * @brief Destructor. Discards the worksheet if close has not been called.
+         */
+        ~XLStreamWriter();
+
+        /**
+         * @brief Copy assignment operator (deleted).
+         */
+        XLStreamWriter& operator=(const XLStreamWriter& other) = delete;
+
+        /**
+         * @brief Move assignment operator.
+         */
+        XLStreamWriter& operator=(XLStreamWriter&& other) noexcept;
+
+        /**
+         * @brief Append a row to the worksheet.
+         * @param values The cell values, index 0 being column A. Empty values do not create a cell.
+         * @throw XLInputError if the writer is closed, the worksheet is full or values has more than MAX_COLS elements.
+         */
+        void appendRow(const std::vector<XLCellValue>& values);
+
+        /**
+         * @brief Skip rows, e.g. to leave a gap between blocks of data.
+         * @param count The number of rows to skip.
+         */
+        void skipRows(uint32_t count);
+
+        /**
+         * @brief Get the number of the last row appended or skipped.
+         * @return The (1-based) row number, 0 if no row has been appended yet.
+         */
+        uint32_t rowNumber() const;
+
+        /**
+         * @brief Complete the worksheet and add it to the workbook.
+         * @throw XLInputError if a sheet with the same name has been added to the workbook in the meantime.
+         */
+        void close();
+
+        /**
+         * @brief Check if the writer accepts more rows.
+         * @return true until close has been called.
+         */
+        bool isOpen() const;
+
+    private:
+        /**
+         * @brief Constructor. Invoked by XLWorkbook::streamWriter.
+         * @param document The document to add the worksheet to.
+         * @param sheetName The name of the new worksheet.
+         */
+        XLStreamWriter(XLDocument* document, std::string sheetName);
+
+        /**
+         * @brief Pass the serialized XML in m_buffer on to the entry writer.
+         */
+        void flush();
+
+        XLDocument*                       m_document {nullptr}; /**< the document the worksheet will be added to */
+        std::string                       m_sheetName;          /**< the name of the new worksheet */
+        std::unique_ptr<XLZipEntryWriter> m_entry;              /**< the archive entry receiving the worksheet XML */
+        std::string                       m_buffer;             /**< serialized XML not yet passed on to m_entry */
+        uint32_t                          m_rowNumber {0};      /**< the number of the last row appended or skipped */
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLSTREAMWRITER_HPP
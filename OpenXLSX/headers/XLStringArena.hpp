@@ -0,0 +1,210 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+#ifndef OPENXLSX_XLSTRINGARENA_HPP
+#define OPENXLSX_XLSTRINGARENA_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <cstddef>    // size_t
+#include <memory>     // std::unique_ptr
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ===== OpenXLSX Includes ===== //
+#include "OpenXLSX-Exports.hpp"
+
+namespace OpenXLSX
+{
+    /**
+     * @brief The XLStringArena class stores the strings of the shared strings table in large memory blocks, addressed through
+     * a table of (pointer, length) entries, instead of one heap allocated std::string per table entry.
+     * @details The strings of a shared strings table loaded with loadXml are not decoded up front: only the position of each
+     * \<si\> element in the XML text is recorded, and an entry is decoded into the arena when it is first accessed. Once all
+     * entries have been decoded, the XML text is released.
+     * Stored strings never move and are always zero-terminated, so that views of them (e.g. the keys of XLSharedStringIndex)
+     * stay valid until the arena is cleared or destroyed.
+     * @warning The arena is not thread safe: decoding on first access modifies it, even through the const member functions.
+     */
+    class OPENXLSX_EXPORT XLStringArena
+    {
+    public:
+        /**
+         * @brief Default constructor
+         */
+        XLStringArena();
+
+        /**
+         * @brief The copy constructor is deleted, views of the stored strings would otherwise be ambiguous
+         */
+        XLStringArena(const XLStringArena& other) = delete;
+
+        /**
+         * @brief Move constructor - views of the stored strings remain valid
+         */
+        XLStringArena(XLStringArena&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         */
+        ~XLStringArena();
+
+        /**
+         * @brief The copy assignment operator is deleted
+         */
+        XLStringArena& operator=(const XLStringArena& other) = delete;
+
+        /**
+         * @brief Move assignment operator - views of the strings stored in other remain valid
+         */
+        XLStringArena& operator=(XLStringArena&& other) noexcept;
+
+        /**
+         * @brief Get the amount of strings in the arena, including entries that have not been decoded yet
+         * @return The amount of strings
+         */
+        size_t size() const { return m_entries.size(); }
+
+        /**
+         * @brief Check if the arena holds no strings
+         * @return true if size() == 0
+         */
+        bool empty() const { return m_entries.empty(); }
+
+        /**
+         * @brief Get a view of a string, decoding it first if needed
+         * @param index The index of the string, must be < size()
+         * @return A view of the string, which is followed by a zero terminator
+         * @throw XLInputError if the \<si\> element of the string can not be decoded
+         */
+        std::string_view view(size_t index) const;
+
+        /**
+         * @brief Get a string as a zero-terminated character array, decoding it first if needed
+         * @param index The index of the string, must be < size()
+         * @return A pointer to the string
+         */
+        const char* c_str(size_t index) const { return view(index).data(); }
+
+        /**
+         * @brief Append a copy of a string
+         * @param str The string to append
+         * @return The index of the appended string
+         */
+        size_t append(std::string_view str);
+
+        /**
+         * @brief Replace the string at index by a copy of str
+         * @param index The index of the string, must be < size()
+         * @param str The new string
+         * @note The memory of the replaced string is not reused until the arena is cleared
+         */
+        void assign(size_t index, std::string_view str);
+
+        /**
+         * @brief Remove all strings and release all memory
+         */
+        void clear();
+
+        /**
+         * @brief Replace the contents of the arena with the entries of a shared strings table
+         * @param xml The XML text of xl/sharedStrings.xml - the arena takes ownership and keeps it until all entries are decoded
+         * @throw XLInputError if a child element of \<sst\> is not a \<si\> element
+         */
+        void loadXml(std::string xml);
+
+        /**
+         * @brief Decode all entries that have not been decoded yet, and release the XML text
+         */
+        void decodeAll() const;
+
+        /**
+         * @brief Get the amount of entries that have not been decoded yet
+         * @return The amount of undecoded entries
+         */
+        size_t undecodedCount() const { return m_undecoded; }
+
+    private:
+        /**
+         * @brief Copy a string into the current memory block, allocating a new block if needed
+         * @return A pointer to the zero-terminated copy
+         */
+        const char* store(std::string_view str) const;
+
+        /**
+         * @brief Decode the \<si\> element of an entry from the XML text into the arena
+         */
+        void decode(size_t index) const;
+
+        /**
+         * @brief An entry of the offset table - data is nullptr while the entry has not been decoded
+         */
+        struct Entry
+        {
+            const char* data {nullptr}; /**< the zero-terminated string in one of the memory blocks */
+            size_t      size {0};       /**< the length of the string */
+        };
+
+        mutable std::vector<Entry>                   m_entries {};       /**< the offset table, addressed by string index */
+        mutable std::vector<std::unique_ptr<char[]>> m_blocks {};        /**< the memory blocks holding the strings */
+        mutable char*                                m_blockPos {};      /**< the first free byte of the current memory block */
+        mutable size_t                               m_blockFree {0};    /**< the amount of free bytes in the current memory block */
+        mutable std::string                          m_xml {};           /**< the XML text of the undecoded entries */
+        mutable std::vector<size_t>                  m_xmlOffsets {};    /**< the position of each loaded entry's <si> element in m_xml */
+        mutable size_t                               m_undecoded {0};    /**< the amount of entries that have not been decoded yet */
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLSTRINGARENA_HPP
@@ -0,0 +1,217 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+#ifndef OPENXLSX_XLTYPEDROW_HPP
+#define OPENXLSX_XLTYPEDROW_HPP
+
+// ===== External Includes ===== //
+#include <array>
+#include <cstdint>     // uint16_t, uint32_t
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+// ===== OpenXLSX Includes ===== //
+#include "XLCell.hpp"
+#include "XLCellValue.hpp"
+#include "XLSheet.hpp"
+
+namespace OpenXLSX
+{
+    //---------- Private Struct to detect std::optional column types ---------- //
+    template<typename T>
+    struct XLIsOptional : std::false_type
+    {};
+    template<typename T>
+    struct XLIsOptional<std::optional<T>> : std::true_type
+    {};
+
+    /**
+     * @brief The XLTypedRowWriter class writes rows of a fixed schema to a worksheet, one column per type in Ts.
+     * @details The conversion of each column is resolved at compile time: values are assigned to the cells with the templated
+     * XLCellValueProxy assignment operator, without constructing XLCellValue objects. A std::optional column clears the cell
+     * for std::nullopt.
+     * ```cpp
+     * XLTypedRowWriter<std::string, int64_t, double> writer(wks);
+     * writer.write(2, "Item", 42, 3.14);            // A2:C2
+     * writer.write(3, std::make_tuple(...));
+     * ```
+     * @tparam Ts bool, integer & floating point types, std::string, XLDateTime, or std::optional of these.
+     */
+    template<typename... Ts>
+    class XLTypedRowWriter
+    {
+        static_assert(sizeof...(Ts) > 0, "XLTypedRowWriter requires at least one column");
+
+    public:
+        /**
+         * @brief Constructor
+         * @param worksheet The worksheet to write to.
+         * @param firstColumn The column of the first type in Ts.
+         */
+        explicit XLTypedRowWriter(const XLWorksheet& worksheet, uint16_t firstColumn = 1) : m_worksheet(worksheet), m_firstColumn(firstColumn) {}
+
+        /**
+         * @brief Write a row, creating the row and its cells as needed.
+         * @param rowNumber The row number (index base 1).
+         * @param values One value per column.
+         */
+        void write(uint32_t rowNumber, const Ts&... values)
+        {
+            XLRowDataRange cells = m_worksheet.row(rowNumber).cells(m_firstColumn, static_cast<uint16_t>(m_firstColumn + sizeof...(Ts) - 1));
+            auto           cell  = cells.begin();
+            ((assignValue(cell->value(), values), ++cell), ...);    // left to right, one cell after the other
+        }
+
+        /**
+         * @brief Write a row from a tuple.
+         * @param rowNumber The row number (index base 1).
+         * @param values One value per column.
+         * @note a template, so that a single column writer does not find write(rowNumber, values) ambiguous
+         */
+        template<typename Tuple, typename = std::enable_if_t<std::is_same_v<Tuple, std::tuple<Ts...>>>>
+        void write(uint32_t rowNumber, const Tuple& values)
+        {
+            std::apply([&](const Ts&... columnValues) { write(rowNumber, columnValues...); }, values);
+        }
+
+    private:
+        /**
+         * @brief assign a value to a cell, resolved at compile time - std::nullopt clears the cell
+         */
+        template<typename T>
+        static void assignValue(XLCellValueProxy& proxy, const T& value)
+        {
+            if constexpr (XLIsOptional<T>::value) {
+                if (value.has_value())
+                    assignValue(proxy, *value);
+                else
+                    proxy.clear();
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+                proxy = value.c_str();    // the templated assignment operator takes its argument by value
+            else
+                proxy = value;
+        }
+
+        XLWorksheet m_worksheet;   /**< the worksheet written to */
+        uint16_t    m_firstColumn; /**< the column of the first value */
+    };
+
+    /**
+     * @brief The XLTypedRowReader class reads rows of a fixed schema from a worksheet, one column per type in Ts.
+     * @details The cells of a row are found in one pass without creating any XML, and each value is decoded straight into its
+     * column type, without constructing XLCellValue objects. A missing or empty cell yields T{} (std::nullopt for a std::optional
+     * column). Conversions follow XLCellValue::get<T>.
+     * ```cpp
+     * XLTypedRowReader<std::string, int64_t, std::optional<double>> reader(wks);
+     * auto [name, count, price] = reader.read(2);    // A2:C2
+     * reader.read(3, item.name, item.count, item.price);
+     * ```
+     * @tparam Ts bool, integer & floating point types, std::string, XLDateTime, or std::optional of these.
+     * @throw XLValueTypeError from read if a cell holds a value that is not convertible to its column type.
+     */
+    template<typename... Ts>
+    class XLTypedRowReader
+    {
+        static_assert(sizeof...(Ts) > 0, "XLTypedRowReader requires at least one column");
+
+    public:
+        /**
+         * @brief Constructor
+         * @param worksheet The worksheet to read from.
+         * @param firstColumn The column of the first type in Ts.
+         */
+        explicit XLTypedRowReader(const XLWorksheet& worksheet, uint16_t firstColumn = 1) : m_worksheet(worksheet), m_firstColumn(firstColumn) {}
+
+        /**
+         * @brief Read a row into variables, e.g. the members of a struct.
+         * @param rowNumber The row number (index base 1).
+         * @param values One variable per column.
+         */
+        void read(uint32_t rowNumber, Ts&... values) const
+        {
+            m_worksheet.findCells(rowNumber, m_firstColumn, static_cast<uint16_t>(sizeof...(Ts)), m_cells.data());
+            size_t index = 0;
+            (readCell(m_cells[index++], values), ...);
+        }
+
+        /**
+         * @brief Read a row into a tuple.
+         * @param rowNumber The row number (index base 1).
+         * @return One value per column.
+         */
+        std::tuple<Ts...> read(uint32_t rowNumber) const
+        {
+            std::tuple<Ts...> values {};
+            std::apply([&](Ts&... columnValues) { read(rowNumber, columnValues...); }, values);
+            return values;
+        }
+
+    private:
+        /**
+         * @brief decode the value of a cell into its column type
+         */
+        template<typename T>
+        static void readCell(const XLCell& cell, T& value)
+        {
+            if (cell.empty() || cell.value().type() == XLValueType::Empty) {
+                value = T {};
+                return;
+            }
+            if constexpr (XLIsOptional<T>::value)
+                value = cell.value().template getTyped<typename T::value_type>();
+            else
+                value = cell.value().template getTyped<T>();
+        }
+
+        XLWorksheet                                  m_worksheet;   /**< the worksheet read from */
+        uint16_t                                     m_firstColumn; /**< the column of the first value */
+        mutable std::array<XLCell, sizeof...(Ts)>    m_cells {};    /**< the cells of the current row, reused for every row */
+    };
+}    // namespace OpenXLSX
+
+#endif    // OPENXLSX_XLTYPEDROW_HPP
@@ -53,11 +53,14 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #endif // _MSC_VER
 
 // ===== External Includes ===== //
+#include <future>     // std::shared_future
 #include <ostream>    // std::basic_ostream
 #include <vector>
 
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
+#include "XLStreamReader.hpp"
+#include "XLStreamWriter.hpp"
 #include "XLXmlFile.hpp"
 
 namespace OpenXLSX
@@ -84,6 +87,7 @@ namespace OpenXLSX
     {
         friend class XLSheet;
         friend class XLDocument;
+        friend class XLStreamWriter;
 
     public:    // ---------- Public Member Functions ---------- //
         /**
@@ -177,6 +181,32 @@ namespace OpenXLSX
          */
         XLChartsheet chartsheet(uint16_t index);
 
+        /**
+         * @brief Get a forward-only reader for the cell values of the worksheet with the given name, that reads the worksheet
+         * row by row without loading the XML document of the worksheet.
+         * @param sheetName The name of the desired worksheet.
+         * @return An XLStreamReader positioned before the first row.
+         * @throw XLInputError if the sheet does not exist or is not a worksheet.
+         */
+        XLStreamReader streamReader(const std::string& sheetName);
+
+        /**
+         * @brief Get a writer that creates a new worksheet by appending rows, serializing them directly into the archive instead
+         * of building the XML document of the worksheet in memory.
+         * @param sheetName The name of the new worksheet.
+         * @return An XLStreamWriter positioned before row 1. The worksheet is added to the workbook by XLStreamWriter::close.
+         * @throw XLInputError if a sheet with that name already exists or the name is not a valid sheet name.
+         */
+        XLStreamWriter streamWriter(const std::string& sheetName);
+
+        /**
+         * @brief Load the XML document of a sheet on a background thread, see XLDocument::prefetch
+         * @param sheetName The name of the sheet to load.
+         * @return A future that becomes ready when the sheet has been loaded.
+         * @throw XLInputError if the sheet does not exist.
+         */
+        std::shared_future<void> prefetch(const std::string& sheetName);
+
         /**
          * @brief Delete sheet (worksheet or chartsheet) from the workbook.
          * @param sheetName Name of the sheet to delete.
@@ -319,6 +349,13 @@ namespace OpenXLSX
         void print(std::basic_ostream<char>& ostr) const;
 
     private:    // ---------- Private Member Functions ---------- //
+        /**
+         * @brief Locate the XML data of a sheet, without parsing it.
+         * @param sheetName The name of the sheet.
+         * @return The XLXmlData object of the sheet.
+         */
+        XLXmlData* sheetXmlData(const std::string& sheetName);
+
         /**
          * @brief
          * @return
@@ -53,16 +53,21 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #endif // _MSC_VER
 
 // ===== External Includes ===== //
+#include <cstdint>    // uint64_t
+#include <future>
 #include <memory>
 #include <string>
 
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
 #include "XLContentTypes.hpp"
+#include "XLSheetBounds.hpp"
 #include "XLXmlParserForwardDeclarations.hpp"
 
 namespace OpenXLSX
 {
+    class XLRowIndex;
+
     constexpr const char * XLXmlDefaultVersion = "1.0";
     constexpr const char * XLXmlDefaultEncoding = "UTF-8";
     constexpr const bool   XLXmlStandalone = true;
@@ -135,6 +140,8 @@ namespace OpenXLSX
      */
     class OPENXLSX_EXPORT XLXmlData final
     {
+        friend class XLDocument;    // memory budget: access tracking and eviction
+
     public:
         // ===== PUBLIC MEMBER FUNCTIONS ===== //
 
@@ -248,7 +255,7 @@ namespace OpenXLSX
         XLContentType getXmlType() const;
 
         /**
-         * @brief Access the underlying XMLDocument object.
+         * @brief Access the underlying XMLDocument object for modification. This marks the data as dirty.
          * @return A pointer to the XMLDocument object.
          */
         XMLDocument* getXmlDocument();
@@ -256,16 +263,82 @@ namespace OpenXLSX
         /**
          * @brief Access the underlying XMLDocument object.
          * @return A const pointer to the XMLDocument object.
+         * @note XMLNode handles obtained from a const XMLDocument still permit modification. Hence, this marks the data as dirty,
+         *  except for a worksheet, whose modifications are recorded by XLSheetBounds.
          */
         const XMLDocument* getXmlDocument() const;
 
+        /**
+         * @brief Parse the XML file from the archive, unless it has been loaded already. Unlike getXmlDocument, this does
+         *  not mark the data as dirty.
+         * @note may be called from several threads at once for different XLXmlData objects of the same document
+         */
+        void load() const;
+
+        /**
+         * @brief Start parsing the XML file from the archive on a background thread, unless it has been loaded already
+         * @return A future that becomes ready when the XML document has been loaded. The first access through
+         *  getXmlDocument or load waits for the background load and rethrows its exception, if any.
+         * @note The document must not modify the archive while a load is pending, see XLDocument::prefetch
+         */
+        std::shared_future<void> loadAsync();
+
+        /**
+         * @brief Test whether the XML document has been loaded (or set) already
+         * @return true if the XML document has a document element
+         */
+        bool isLoaded() const;
+
         /**
          * @brief Test whether there is an XML file linked to this object
          * @return true if there is no underlying XML file, otherwise false
          */
         bool empty() const;
 
+        /**
+         * @brief Test whether the XML document may differ from the entry in the source archive
+         * @return true if the raw data was set, if the XMLDocument was handed out for modification (see getXmlDocument), or if
+         *  a modification of a worksheet was recorded in its XLSheetBounds, otherwise false
+         * @note a part that is not dirty can be copied from the source archive as-is on save
+         */
+        bool isDirty() const;
+
+        /**
+         * @brief Access the row index of a worksheet's XML document, created on first access.
+         * @return A reference to the XLRowIndex.
+         */
+        XLRowIndex& rowIndex();
+
+        /**
+         * @brief Access the cached column extent of a worksheet's XML document, created on first access.
+         * @return A reference to the XLSheetBounds.
+         */
+        XLSheetBounds& sheetBounds();
+
     private:
+        // ===== PRIVATE MEMBER FUNCTIONS ===== //
+
+        /**
+         * @brief Parse the XML file from the archive, unless it has been loaded already, without regard to a pending loadAsync
+         */
+        void loadFromArchive() const;
+
+        /**
+         * @brief Record an access to the XML document for the memory budget of the parent document
+         */
+        void touch() const;
+
+        /**
+         * @brief Drop the XML document (and the row index into it), so that it is reloaded from the archive on next access
+         * @note dirty data must have been written to the archive before, see XLDocument::evict
+         */
+        void unload();
+
+        /**
+         * @brief Mark the XML document as identical to the entry in the archive, after it has been written there
+         */
+        void markClean();
+
         // ===== PRIVATE MEMBER VARIABLES ===== //
 
         XLDocument*                          m_parentDoc {}; /**< A pointer to the parent XLDocument object. >*/
@@ -273,6 +346,14 @@ namespace OpenXLSX
         std::string                          m_xmlID {};     /**< The relationship ID of the XML data. >*/
         XLContentType                        m_xmlType {};   /**< The type represented by the XML data. >*/
         mutable std::unique_ptr<XMLDocument> m_xmlDoc;       /**< The underlying XMLDocument object. >*/
+        mutable bool                         m_dirty {false}; /**< true if m_xmlDoc was handed out for modification, see isDirty >*/
+        std::unique_ptr<XLRowIndex>          m_rowIndex;      /**< row number to row node index of a worksheet, see rowIndex >*/
+        XLSheetBoundsRef                     m_sheetBounds;   /**< column extent of a worksheet, see sheetBounds >*/
+        mutable std::shared_future<void>     m_pendingLoad {}; /**< a background load started by loadAsync, not yet waited for >*/
+        mutable size_t                       m_xmlSize {0};   /**< size in bytes of the XML text that m_xmlDoc was parsed from >*/
+        mutable uint64_t                     m_lastAccess {0}; /**< access clock value of the last getXmlDocument call >*/
+        mutable bool                         m_resident {false}; /**< true once a loaded m_xmlDoc has been accounted for by touch >*/
+        mutable bool                         m_evicted {false};  /**< true if m_xmlDoc was dropped by the memory budget >*/
     };
 }    // namespace OpenXLSX
 
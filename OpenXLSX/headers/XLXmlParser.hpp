@@ -47,6 +47,9 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #define OPENXLSX_XLXMLPARSER_HPP
 
 #include <memory> // shared_ptr
+#include <atomic>
+#include <new>    // placement new, std::launder
+#include <type_traits>
 
 // ===== pugixml header needed for pugi::impl::xml_memory_page_type_mask, pugi::xml_node_type, pugi::char_t, pugi::node_element, pugi::xml_node, pugi::xml_attribute, pugi::xml_document
 #include <pugixml.hpp>                   // include public pugixml header, wherever it may be in the include paths
@@ -60,16 +63,12 @@ namespace { // anonymous namespace to define constants / functions that shall no
 namespace OpenXLSX
 {
 #   define ENABLE_XML_NAMESPACES 1    // disable this line to control behavior via compiler flag
-#   define NO_MULTITHREADING_SAFETY 1 // if this is defined, the function namespaced_name_char will be used for XML namespace support,
-//                                    //  using a static character array for improved performance when multithreading conflicts are not a risk
+//  2026-10-17: namespaced_name_char now concatenates into a thread_local buffer and is safe to use from concurrent threads,
+//              the NO_MULTITHREADING_SAFETY switch to the slower namespaced_name_shared_ptr has therefore been removed
 
 #   ifdef ENABLE_XML_NAMESPACES
         // ===== Macro for NAMESPACED_NAME when node names might need to be prefixed with the current node's namespace
-#       ifdef NO_MULTITHREADING_SAFETY
-#           define NAMESPACED_NAME(name_, force_ns_) namespaced_name_char(name_, force_ns_)
-#       else
-#           define NAMESPACED_NAME(name_, force_ns_) namespaced_name_shared_ptr(name_, force_ns_).get()
-#       endif
+#       define NAMESPACED_NAME(name_, force_ns_) namespaced_name_char(name_, force_ns_)
 #   else
         // ===== Optimized version when no namespace support is desired - ignores force_ns_ setting
 #       define NAMESPACED_NAME(name_, force_ns_) name_
@@ -83,7 +82,7 @@ namespace OpenXLSX
      * Affected XMLNode methods: ::set_name, ::append_child, ::prepend_child, ::insert_child_after, ::insert_child_before
      */
 
-    extern bool NO_XML_NS; // defined in XLXmlParser.cpp - default: no XML namespaces
+    extern std::atomic<bool> NO_XML_NS; // defined in XLXmlParser.cpp - default: no XML namespaces. Atomic so that threads may read it concurrently
     /**
      * @brief Set NO_XML_NS to false
      * @return true if PUGI_AUGMENTED is defined (success), false if PUGI_AUGMENTED is not in use (function would be pointless)
@@ -116,7 +115,7 @@ namespace OpenXLSX
         // explicit OpenXLSX_xml_node(base b) : pugi::xml_node(b), name_begin(0) // TBD on explicit keyword
         OpenXLSX_xml_node(base b) : pugi::xml_node(b), name_begin(0)
         {
-            if (NO_XML_NS) return;
+            if (NO_XML_NS.load(std::memory_order_relaxed)) return;
                 const char *name = xml_node::name();
             int pos = 0;
             while (name[pos] && name[pos] != ':') ++pos; // find name delimiter
@@ -135,6 +134,7 @@ namespace OpenXLSX
          * @param name_ a node name which shall be prefixed with this node's current namespace
          * @param force_ns if true, will return name_ unmodified
          * @return this node's current namespace + ":" + name_ as a const pugi::char_t *
+         * @note the returned pointer refers to a thread_local buffer that remains valid until the next call from the same thread
          */
         const pugi::char_t* namespaced_name_char(const pugi::char_t* name_, bool force_ns) const;
 
@@ -143,8 +143,10 @@ namespace OpenXLSX
          * @param name_ a node name which shall be prefixed with this node's current namespace
          * @param force_ns if true, will return name_ unmodified
          * @return this node's current namespace + ":" + name_ as a shared_ptr to pugi::char_t
+         * @deprecated namespaced_name_char is thread safe and avoids the allocation, use it instead and copy the result if it must
+         *  outlive the next call
          */
-        std::shared_ptr<pugi::char_t> namespaced_name_shared_ptr(const pugi::char_t* name_, bool force_ns) const;
+        [[deprecated]] std::shared_ptr<pugi::char_t> namespaced_name_shared_ptr(const pugi::char_t* name_, bool force_ns) const;
 
 
         // ===== BEGIN: Wrappers for xml_node member functions to ensure OpenXLSX_xml_node return values
@@ -278,5 +280,19 @@ namespace OpenXLSX
         // ===== END: Wrappers for xml_document member functions
     };
 
+    // ===== XMLNodeStorage member functions, see XLXmlParserForwardDeclarations.hpp
+    static_assert(sizeof(XMLNode) <= 2 * sizeof(void*) && alignof(XMLNode) <= alignof(void*), "XMLNodeStorage is too small for XMLNode");
+    static_assert(std::is_trivially_copyable_v<XMLNode> && std::is_trivially_destructible_v<XMLNode>, "XMLNodeStorage copies XMLNode bytewise");
+
+    inline XMLNodeStorage::XMLNodeStorage(const XMLNode& node) { new (m_storage) XMLNode(node); }
+    inline XMLNodeStorage& XMLNodeStorage::operator=(const XMLNode& node)
+    {
+        new (m_storage) XMLNode(node);
+        return *this;
+    }
+    inline XMLNode& XMLNodeStorage::operator*() const { return *get(); }
+    inline XMLNode* XMLNodeStorage::operator->() const { return get(); }
+    inline XMLNode* XMLNodeStorage::get() const { return std::launder(reinterpret_cast<XMLNode*>(m_storage)); }
+
 }    // namespace OpenXLSX
 #endif    // OPENXLSX_XLXMLPARSER_HPP
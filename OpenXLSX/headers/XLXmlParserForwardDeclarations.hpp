@@ -79,6 +79,29 @@ namespace OpenXLSX {
         using XMLAttribute = pugi::xml_attribute;
         using XMLDocument  = pugi::xml_document;
 #   endif
+
+    /**
+     * @brief Inline storage for an XMLNode, used for XMLNode members of classes that are declared with the forward declarations
+     * only, instead of a std::unique_ptr<XMLNode> that requires a heap allocation for every object (e.g. every iterator step).
+     * @details Used like a pointer that always points to a node: operator* and operator-> return the stored XMLNode, which is empty
+     * for a default constructed object. As with std::unique_ptr, constness is shallow. The member functions are defined in
+     * XLXmlParser.hpp, where XMLNode is a complete type. XMLNode is trivially copyable, so the implicit copy and move operations
+     * of this class copy the node.
+     */
+    class XMLNodeStorage
+    {
+    public:
+        XMLNodeStorage() = default;
+        XMLNodeStorage(const XMLNode& node);
+        XMLNodeStorage& operator=(const XMLNode& node);
+
+        XMLNode& operator*() const;
+        XMLNode* operator->() const;
+        XMLNode* get() const;
+
+    private:
+        alignas(void*) mutable unsigned char m_storage[2 * sizeof(void*)] {};    /**< all-zero bytes represent an empty XMLNode */
+    };
 }    // namespace OpenXLSX
 
 #endif // OPENXLSX_XLXMLPARSER_FORWARD_DECLARATIONS_HPP
@@ -54,10 +54,12 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 // ===== External Includes ===== //
 #include <memory>    // std::shared_ptr
+#include <mutex>     // std::mutex, std::unique_lock
 #include <cstddef>      // size_t
 #include <type_traits>  // std::make_signed_t
 
 // ===== OpenXLSX Includes ===== //
+#include "IZipArchive.hpp"      // XLZipOpenMode
 #include "OpenXLSX-Exports.hpp"
 
 #ifdef USE_LIBZIP
@@ -99,6 +101,12 @@ namespace OpenXLSX
          */
         XLZipArchive();
 
+        /**
+         * @brief Construct an archive that will be opened in the given mode
+         * @param openMode XLZipOpenMode::MemoryMapped to map archive files read-only instead of reading them into memory
+         */
+        explicit XLZipArchive(XLZipOpenMode openMode);
+
         /**
          * @brief
          * @param other
@@ -162,6 +170,20 @@ namespace OpenXLSX
          */
         void close();
 
+        /**
+         * @brief set the mode used by subsequent calls to open
+         * @param openMode XLZipOpenMode::Buffered (default) or XLZipOpenMode::MemoryMapped
+         * @note with MemoryMapped, open latency no longer scales with the archive size. If the file can not be mapped
+         *  (e.g. on platforms without mmap support), the archive silently falls back to Buffered.
+         */
+        void setOpenMode(XLZipOpenMode openMode) { m_openMode = openMode; }
+
+        /**
+         * @brief get the mode used by calls to open
+         * @return the configured XLZipOpenMode
+         */
+        XLZipOpenMode openMode() const { return m_openMode; }
+
         /**
          * @brief make archive updates (from addEntry) available to calls via getEntry
          */
@@ -170,8 +192,9 @@ namespace OpenXLSX
         /**
          * @brief
          * @param path
+         * @param compressionThreads amount of threads used to compress modified entries, 0 = hardware concurrency (miniz only)
          */
-        void save(const std::string& path = "");
+        void save(const std::string& path = "", unsigned int compressionThreads = 1);
 
         /**
          * @brief
@@ -200,6 +223,35 @@ namespace OpenXLSX
          */
         std::string getEntry(const std::string& name) const;
 
+        /**
+         * @brief Extract the data of an entry directly into a buffer obtained from allocate, without an intermediate copy
+         * @param name The name of the entry
+         * @param size Receives the size of the entry data in bytes
+         * @param allocate The function used to allocate the returned buffer - ownership passes to the caller
+         * @param deallocate The function used to release the buffer if extraction fails
+         * @return The buffer holding the entry data (size bytes), never nullptr
+         * @note this allows handing the data over to a consumer that takes ownership of the buffer, e.g. pugixml
+         *  xml_document::load_buffer_inplace_own with pugi::get_memory_allocation_function
+         * @note may be called from several threads at once for unmodified entries, e.g. to parse worksheets concurrently.
+         *  With libzip, all reads from the archive are serialized behind a lock owned by the archive.
+         */
+        void* getEntryBuffer(const std::string& name, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*)) const;
+
+        /**
+         * @brief Open a sequential reader on an entry, that decompresses the entry data incrementally as it is read
+         * @param name The name of the entry
+         * @return The entry stream, which keeps the underlying archive object alive
+         * @note the stream takes the same lock as getEntryBuffer for each read, so it can be used while other entries
+         *  are extracted concurrently
+         */
+        std::unique_ptr<XLZipEntryStream> openEntryStream(const std::string& name) const;
+
+        /**
+         * @brief Open a writer for a new entry, that compresses the entry data as it is written
+         * @return The entry writer, which keeps the underlying archive object alive
+         */
+        std::unique_ptr<XLZipEntryWriter> openEntryWriter() const;
+
         /**
          * @brief
          * @param entryName
@@ -221,7 +273,15 @@ namespace OpenXLSX
         std::string entryName( int index ) const;
 
     private:
+        /**
+         * @brief Lock the archive handle for a call into the zip library
+         * @return The lock on m_mutex with libzip, an empty lock with zippy, which needs no serialization
+         */
+        std::unique_lock<std::mutex> lockArchive() const;
+
         std::shared_ptr<XLZipImplementation> m_archive; /**< */
+        std::shared_ptr<std::mutex>          m_mutex;   /**< serializes the use of the archive handle, shared with shallow copies */
+        XLZipOpenMode                        m_openMode {XLZipOpenMode::Buffered}; /**< mode used by open */
     };
 }    // namespace OpenXLSX
 
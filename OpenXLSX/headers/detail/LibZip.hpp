@@ -2,6 +2,7 @@
 #define LIBZIP_WRAPPER_H
 
 // ===== External Includes ===== //
+#include <cerrno>       // errno
 #include <cstddef>      // size_t
 #include <cstdio>       // fprintf
 #include <random>       // std::random_device, std::mt19937, std::uniform_int_distribution
@@ -61,10 +62,107 @@ namespace LibZip {
     };
 
 
+    /**
+     * @brief sequential reader for a single archive file, decompressing the data in chunks as it is read
+     * @note a ZipEntryReader must not be used after the ZipArchive that created it has been closed or saved
+     */
+    class ZipEntryReader {
+    private:
+        zip_file_t *m_fd;   // the libzip file descriptor of the archive file
+
+    public:
+        explicit ZipEntryReader(zip_file_t *fd) : m_fd(fd) {}
+        ZipEntryReader(const ZipEntryReader& other) = delete;
+        ZipEntryReader(ZipEntryReader&& other) noexcept : m_fd(other.m_fd) { other.m_fd = nullptr; }
+        ZipEntryReader& operator=(const ZipEntryReader& other) = delete;
+        ZipEntryReader& operator=(ZipEntryReader&& other) = delete;
+        ~ZipEntryReader() { if (m_fd != nullptr) zip_fclose(m_fd); }
+
+        /**
+         * @brief read the next chunk of archive file data
+         * @param buffer destination buffer
+         * @param size capacity of buffer in bytes
+         * @return number of bytes written to buffer, 0 at the end of the archive file
+         * @throw LibZipInternalError if the data can not be read
+         */
+        size_t Read(void *buffer, size_t size)
+        {
+            const zip_int64_t count = zip_fread(m_fd, buffer, size);
+            if (count < 0)
+                throw LibZipInternalError(std::string("ZipEntryReader::Read: failed to read archive file: ") + zip_error_strerror(zip_file_get_error(m_fd)));
+            return static_cast<size_t>(count);
+        }
+    };
+
+    /**
+     * @brief sequential writer for a new archive file: the data is spooled to a temporary file next to the archive, from which
+     *  libzip compresses it when the entry is committed - the entry data is never held in memory as a whole
+     * @note libzip can not take over raw deflate data, hence the spooling of uncompressed data
+     */
+    class ZipEntryWriter {
+    private:
+        std::string  m_path;   // the temporary file
+        FILE        *m_file;   // the open temporary file, nullptr once closed
+
+    public:
+        explicit ZipEntryWriter(std::string path) : m_path(std::move(path)), m_file(OpenXLSX::fopen(m_path, "wb"))
+        {
+            if (m_file == nullptr)
+                throw LibZipInternalError("ZipEntryWriter: failed to create temporary file " + m_path + ": " + strerror(errno));
+        }
+        ZipEntryWriter(const ZipEntryWriter& other) = delete;
+        ZipEntryWriter(ZipEntryWriter&& other) noexcept : m_path(std::move(other.m_path)), m_file(other.m_file)
+        {
+            other.m_path.clear();
+            other.m_file = nullptr;
+        }
+        ZipEntryWriter& operator=(const ZipEntryWriter& other) = delete;
+        ZipEntryWriter& operator=(ZipEntryWriter&& other) = delete;
+        ~ZipEntryWriter()
+        {
+            if (m_file != nullptr) fclose(m_file);
+            if (!m_path.empty()) OpenXLSX::remove(m_path);
+        }
+
+        /**
+         * @brief append data to the archive file
+         * @param data the data to append
+         * @param size size of data in bytes
+         * @throw LibZipInternalError if the data can not be written
+         */
+        void Write(const void *data, size_t size)
+        {
+            if (m_file == nullptr)
+                throw LibZipInputError("ZipEntryWriter::Write: writer has already been committed");
+            if (fwrite(data, 1, size, m_file) != size)
+                throw LibZipInternalError("ZipEntryWriter::Write: failed to write temporary file " + m_path + ": " + strerror(errno));
+        }
+
+        /**
+         * @brief close the temporary file and reopen it for reading
+         * @return FILE pointer for reading the archive file data from the start
+         */
+        FILE *Finish()
+        {
+            if (m_file == nullptr)
+                throw LibZipInputError("ZipEntryWriter::Finish: writer has already been committed");
+            const bool flushed = (fclose(m_file) == 0);
+            m_file = nullptr;
+            if (!flushed)
+                throw LibZipInternalError("ZipEntryWriter::Finish: failed to write temporary file " + m_path + ": " + strerror(errno));
+
+            FILE *file = OpenXLSX::fopen(m_path, "rb");
+            if (file == nullptr)
+                throw LibZipInternalError("ZipEntryWriter::Finish: failed to reopen temporary file " + m_path + ": " + strerror(errno));
+            return file;
+        }
+    };
+
     class ZipArchive {
     private:
         void           *m_zipData;    // the raw data of the unmodified source archive, (re-)set on ZipArchive::Open
         size_t          m_zipSize;    // the size in bytes of the unmodified source archive stored at m_zipData
+        bool            m_zipMapped;  // true if m_zipData is a read-only file mapping, owned by this class instead of m_zipSrc
         zip_error_t     m_zipError;   // TBD how useful: save zip_error_t states across different methods
         zip_source_t   *m_zipSrc;     // the zip source, as opposed to the archive - TBD what the logic of this is
         zip_t          *m_za;         // the zip archive - changes must be committed before they can be read via GetEntryDataAsString
@@ -142,6 +240,30 @@ namespace LibZip {
             return 0;
         }
 
+        /**
+         * @brief map filename read-only into memory as this->m_zipData, fall back to loadArchiveData if mapping fails
+         * @param filename map this file
+         * @return 0 on success, -1 on failure
+         */
+        int mapArchiveData(std::string filename)
+        {
+            m_zipData = OpenXLSX::mapFile(filename, m_zipSize);
+            if (m_zipData != nullptr) {
+                m_zipMapped = true;
+                return 0;
+            }
+            return loadArchiveData(filename);    // e.g. empty file or no mmap support on this platform
+        }
+
+        /**
+         * @brief release a read-only file mapping in m_zipData - a malloc'ed m_zipData is owned (and freed) by m_zipSrc
+         */
+        void unmapArchiveData()
+        {
+            if (m_zipMapped) OpenXLSX::unmapFile(m_zipData, m_zipSize);
+            m_zipMapped = false;
+        }
+
         /**
          * @brief Save size bytes from data to a temporary file, then move that to filename
          * @param data save data from here
@@ -180,7 +302,7 @@ namespace LibZip {
          * @brief construct an empty ZipArchive
          */
         ZipArchive()
-        : m_zipData(nullptr), m_zipSize(0), m_zipSrc(nullptr), m_za(nullptr), m_name("") {}
+        : m_zipData(nullptr), m_zipSize(0), m_zipMapped(false), m_zipSrc(nullptr), m_za(nullptr), m_name("") {}
 
         /**
          * @brief destructor: close zip archive if open
@@ -220,6 +342,7 @@ namespace LibZip {
 // printf( "zip_file_attributes::general_purpose_bit_flags is 0x%08x\n", static_cast< uint16_t >( zipAttrs.general_purpose_bit_flags ) );
 
             closeZip();    // invalidates m_zipData and m_zipSrc because reference count for the underlying zip source should reach zero
+            unmapArchiveData();  // a mapping is not freed by m_zipSrc
             m_zipData = nullptr;
             m_zipSize = 0;
             m_zipSrc = nullptr;
@@ -229,23 +352,25 @@ namespace LibZip {
         /**
          * @brief Open an existing archive file
          * @param archiveName the file to load from
+         * @param memoryMapped if true, map the archive file read-only into memory instead of reading it into a buffer
          * @return N/A
          * @throw LibZipInputError if archive is already open
          * @throw LibZipInternalError if archiveName can't be opened / loaded
          */
-        void Open(std::string archiveName) {
+        void Open(std::string archiveName, bool memoryMapped = false) {
             using namespace std::literals::string_literals;
             if (IsOpen())
                 throw LibZipInputError("ZipArchive::Open: archive is already open for source file "s + m_name); // user must close the archive before re-opening
 
             /* get buffer with zip archive inside */
-            if (loadArchiveData(archiveName) < 0)
+            if ((memoryMapped ? mapArchiveData(archiveName) : loadArchiveData(archiveName)) < 0)
                 throw LibZipInternalError("ZipArchive::Open: failed to load archive data from file "s + archiveName);
 
             zip_error_init(&m_zipError);
-            /* create source from buffer */
-            if ((m_zipSrc = zip_source_buffer_create(m_zipData, m_zipSize, 1, &m_zipError)) == nullptr) {
-                free(m_zipData);
+            /* create source from buffer - the source must only free a malloc'ed buffer, never a mapping */
+            if ((m_zipSrc = zip_source_buffer_create(m_zipData, m_zipSize, m_zipMapped ? 0 : 1, &m_zipError)) == nullptr) {
+                if (m_zipMapped) unmapArchiveData();
+                else free(m_zipData);
                 m_zipData = nullptr;   // prevent double-free
                 zip_error_fini(&m_zipError);
                 throw LibZipInternalError("ZipArchive::Open: can't create source: "s + zip_error_strerror(&m_zipError));
@@ -271,11 +396,13 @@ namespace LibZip {
         /**
          * @brief Save the (modified) archive to savePath
          * @param savePath save here, or save to original filename if empty string is provided
+         * @param compressionThreads ignored - libzip compresses entries on zip_close, with its own (sequential) logic
          * @return N/A
          * @throw LibZipInternalError upon any failure
          */
-        void Save(std::string savePath)
+        void Save(std::string savePath, unsigned int compressionThreads = 1)
         {
+            (void) compressionThreads;
             if (!IsOpen()) throw LibZipInputError("ZipArchive::Save: archive is not open!");
 
             if (savePath.empty()) // saving in original file location!
@@ -311,10 +438,31 @@ namespace LibZip {
                     throw LibZipInternalError("ZipArchive::Save: can't read saveData from source: "s + zip_error_strerror(zip_source_error(m_zipSrc)));
                 }
                 zip_source_close(m_zipSrc);                           // close the zip source
-                if (saveArchiveFile(saveData, saveSize, savePath.c_str()) < 0) // and save the archive
-                    throw LibZipInternalError("ZipArchive::Save: failed to save archive data to "s + savePath);
+                if (m_zipMapped) {
+                    // ===== m_zipSrc may still read from the file mapping: continue from saveData instead & release the mapping,
+                    //       so that saveArchiveFile can replace the mapped file (required on Windows)
+                    zip_error_init(&m_zipError);
+                    zip_source_t *saveSrc = zip_source_buffer_create(saveData, saveSize, 1, &m_zipError);
+                    if (saveSrc == nullptr) {
+                        free(saveData);
+                        zip_error_fini(&m_zipError);
+                        throw LibZipInternalError("ZipArchive::Save: can't create source from saveData: "s + zip_error_strerror(&m_zipError));
+                    }
+                    zip_error_fini(&m_zipError);
+                    zip_source_free(m_zipSrc);
+                    unmapArchiveData();
+                    m_zipSrc  = saveSrc;    // saveData is now owned by m_zipSrc
+                    m_zipData = saveData;
+                    m_zipSize = saveSize;
+                    if (saveArchiveFile(saveData, saveSize, savePath.c_str()) < 0) // and save the archive
+                        throw LibZipInternalError("ZipArchive::Save: failed to save archive data to "s + savePath);
+                }
+                else {
+                    if (saveArchiveFile(saveData, saveSize, savePath.c_str()) < 0) // and save the archive
+                        throw LibZipInternalError("ZipArchive::Save: failed to save archive data to "s + savePath);
 
-                free(saveData);         // free temporary buffer used for saving the archive
+                    free(saveData);         // free temporary buffer used for saving the archive
+                }
             }
 
             reopenFromZipSource();  // ensure that archive is valid again for further modifications
@@ -409,6 +557,118 @@ namespace LibZip {
             return entryDataAsString;
         }
 
+        /**
+         * @brief Read the contents of an archive file into a buffer obtained from allocate, without an intermediate copy
+         * @param entryName archive file to fetch
+         * @param size receives the size of the entry data in bytes
+         * @param allocate function used to allocate the returned buffer - ownership passes to the caller
+         * @param deallocate function used to release the buffer on failure
+         * @return buffer of size bytes (allocated with at least 1 byte, even if size is 0)
+         * @throw LibZipInputError when called on a non-valid archive or if entryName does not exist in the archive
+         * @throw LibZipInternalError upon any other failure
+         */
+        void* GetEntryDataToBuffer(const std::string& entryName, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*)) const
+        {
+            using namespace std::literals::string_literals;
+
+            if (!IsOpen())
+                throw LibZipInputError("ZipArchive::GetEntryDataToBuffer: archive is not open!");
+
+            int index = zip_name_locate(m_za, entryName.c_str(), 0);   // ensure that entryName exists in the archive
+            if (index == -1)
+                throw LibZipInputError("ZipArchive::GetEntryDataToBuffer: archive does not contain file: "s + entryName);
+
+            // determine how many bytes entry data encompasses
+            struct zip_stat entryInfo;
+            if (0 != zip_stat_index(m_za, index, 0, &entryInfo))
+                throw LibZipInternalError("ZipArchive::GetEntryDataToBuffer: failed to obtain archive entry info for "s + entryName + ": "s + zip_error_strerror(zip_get_error(m_za)));
+            size = static_cast<size_t>(entryInfo.size);
+
+            zip_file_t *fd = zip_fopen_index(m_za, index, 0);                            // get a file descriptor for desired entry
+            if (fd == nullptr)
+                throw LibZipInternalError("ZipArchive::GetEntryDataToBuffer: an error occurred trying to open archive file "s + entryName + ": "s + zip_error_strerror(zip_get_error(m_za)));
+
+            void *buffer = allocate(size > 0 ? size : 1);
+            if (buffer == nullptr) {
+                zip_fclose(fd);
+                throw LibZipInternalError("ZipArchive::GetEntryDataToBuffer: failed to allocate buffer for "s + entryName);
+            }
+            if (size > 0 && zip_fread(fd, buffer, size) != static_cast<zip_int64_t>(size)) {   // read entry data directly into buffer
+                deallocate(buffer);
+                zip_fclose(fd);
+                throw LibZipInternalError("ZipArchive::GetEntryDataToBuffer: failed to read archive file "s + entryName);
+            }
+            zip_fclose(fd);                                                              // close file descriptor
+
+            return buffer;
+        }
+
+        /**
+         * @brief open a sequential reader on an archive file, to process its contents without holding them in memory as a whole
+         * @param entryName archive file to read
+         * @return ZipEntryReader for entryName
+         * @throw LibZipInputError when called on a non-valid archive or if entryName does not exist in the archive
+         * @throw LibZipInternalError if the archive file can not be opened
+         */
+        ZipEntryReader OpenEntryReader(const std::string& entryName) const
+        {
+            using namespace std::literals::string_literals;
+
+            if (!IsOpen())
+                throw LibZipInputError("ZipArchive::OpenEntryReader: archive is not open!");
+
+            int index = zip_name_locate(m_za, entryName.c_str(), 0);
+            if (index == -1)
+                throw LibZipInputError("ZipArchive::OpenEntryReader: archive does not contain file: "s + entryName);
+
+            zip_file_t *fd = zip_fopen_index(m_za, index, 0);
+            if (fd == nullptr)
+                throw LibZipInternalError("ZipArchive::OpenEntryReader: an error occurred trying to open archive file "s + entryName + ": "s + zip_error_strerror(zip_get_error(m_za)));
+
+            return ZipEntryReader(fd);
+        }
+
+        /**
+         * @brief open a writer for a new archive file, to add large data without holding it in memory
+         * @return ZipEntryWriter, to be passed to CommitEntryWriter when complete
+         * @throw LibZipInputError when called on a non-valid archive
+         */
+        ZipEntryWriter OpenEntryWriter() const
+        {
+            if (!IsOpen())
+                throw LibZipInputError("ZipArchive::OpenEntryWriter: archive is not open!");
+            return ZipEntryWriter(OpenXLSX::GenerateRandomNameInSamePath(m_name, 20));
+        }
+
+        /**
+         * @brief add the data of a ZipEntryWriter to the archive as entryName & commit changes, so that the temporary file of the
+         *  writer is no longer needed
+         * @param entryName archive file to add - an existing archive file will be overwritten
+         * @param writer the writer holding the archive file data
+         * @throw LibZipInputError when called on a non-valid archive
+         * @throw LibZipInternalError upon any other failure
+         */
+        void CommitEntryWriter(const std::string& entryName, ZipEntryWriter& writer)
+        {
+            using namespace std::literals::string_literals;
+
+            if (!IsOpen())
+                throw LibZipInputError("ZipArchive::CommitEntryWriter: archive is not open!");
+
+            FILE *file = writer.Finish();
+            struct zip_source *zipSrc = zip_source_filep(m_za, file, 0, -1);  // libzip takes ownership of file
+            if (!zipSrc) {
+                fclose(file);
+                throw LibZipInternalError("ZipArchive::CommitEntryWriter: failed to create a zip source from entry data");
+            }
+
+            if (-1 == zip_file_add(m_za, entryName.c_str(), zipSrc, ZIP_FL_OVERWRITE | ZIP_FL_ENC_UTF_8)) {
+                zip_source_free(zipSrc);
+                throw LibZipInternalError("ZipArchive::CommitEntryWriter: failed to add file to archive: "s +  zip_error_strerror(zip_get_error(m_za)));
+            }
+            CommitChanges();    // libzip reads the file data now
+        }
+
         /**
          * @brief test whether a file exists in the archive
          * @param entryName archive file to locate
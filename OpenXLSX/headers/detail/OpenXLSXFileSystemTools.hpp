@@ -3,8 +3,22 @@
 
 #ifdef _WIN32
     #include <algorithm>            // std::replace
+    #ifndef NOMINMAX
+        #define NOMINMAX            // prevent windows.h min / max macros
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>            // CreateFileMapping, MapViewOfFile, UnmapViewOfFile
+#elif !defined(__amigaos__)
+    #define OPENXLSX_HAVE_MMAP
+    #include <fcntl.h>              // ::open
+    #include <sys/mman.h>           // mmap, munmap
+    #include <sys/stat.h>           // fstat
+    #include <unistd.h>             // ::close
 #endif
 #ifdef ENABLE_NOWIDE
+    #include <nowide/convert.hpp>   // nowide::widen
     #include <nowide/cstdio.hpp>    // nowide::fopen, nowide::remove, nowide::rename
     #include <nowide/stat.hpp>
     namespace boost {}              // ensure that namespace exists, even if boost doesn't define it
@@ -117,6 +131,75 @@ namespace OpenXLSX
 #       endif
     }
 
+    /**
+     * @brief map a file read-only into memory, with support for unicode filenames on Windows. Pages are loaded lazily by the OS.
+     * @param fileName (unicode) name of the file to map
+     * @param size receives the size of the mapping in Bytes (0 on failure)
+     * @return pointer to the mapped file data on success, to be released with unmapFile
+     * @return nullptr on failure, for an empty file, or if memory mapping is not supported on the platform
+     */
+    inline void* mapFile(const std::string& fileName, size_t& size)
+    {
+        size = 0;
+#       if defined(_WIN32)
+#           ifdef ENABLE_NOWIDE
+                HANDLE file = CreateFileW(nowide::widen(fileName).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#           else
+                HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#           endif
+            if (file == INVALID_HANDLE_VALUE) return nullptr;
+
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) { CloseHandle(file); return nullptr; }
+
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(file);                  // the mapping keeps the file open
+            if (mapping == nullptr) return nullptr;
+
+            void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);               // the view keeps the mapping alive
+            if (data == nullptr) return nullptr;
+
+            size = static_cast<size_t>(fileSize.QuadPart);
+            return data;
+#       elif defined(OPENXLSX_HAVE_MMAP)
+            int fd = ::open(fileName.c_str(), O_RDONLY);
+            if (fd < 0) return nullptr;
+
+            struct stat info;
+            if (fstat(fd, &info) != 0 || info.st_size <= 0) { ::close(fd); return nullptr; }
+
+            void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);                        // the mapping remains valid after closing the file descriptor
+            if (data == MAP_FAILED) return nullptr;
+
+            size = static_cast<size_t>(info.st_size);
+            return data;
+#       else
+            (void) fileName;
+            return nullptr;                     // no memory mapping support: caller shall fall back to reading the file
+#       endif
+    }
+
+    /**
+     * @brief release a mapping created by mapFile
+     * @param data the pointer returned by mapFile
+     * @param size the size returned by mapFile
+     */
+    inline void unmapFile(void* data, size_t size)
+    {
+        if (data == nullptr) return;
+#       if defined(_WIN32)
+            (void) size;
+            UnmapViewOfFile(data);
+#       elif defined(OPENXLSX_HAVE_MMAP)
+            munmap(data, size);
+#       else
+            (void) data;
+            (void) size;
+#       endif
+    }
+
     /**
      * @brief Generates a random filename, which is used to generate a temporary archive when modifying and saving
      * archive files.
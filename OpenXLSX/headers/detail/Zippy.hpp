@@ -2,13 +2,18 @@
 #define ZIPPY2_LIBRARY_H
 
 #include <algorithm>
+#include <atomic>
 #include <ctime>
 #include <fstream>
+#include <memory>
 #include <miniz.h>
 #include <miniz_zip.h>
 #include <random>
 #include <stdexcept>
 #include <sys/stat.h>
+#include <system_error>
+#include <thread>
+#include <vector>
 
 #ifdef _WIN32
 #include <direct.h>
@@ -134,6 +139,49 @@ namespace Zippy
 
     namespace Impl
     {
+        /**
+         * @brief The Impl::DeflatedData class holds the raw deflate stream and CRC-32 of a single entry, compressed ahead of
+         * the (strictly sequential) archive writer, so that the compression of several entries can run on worker threads. It also
+         * holds the output of a ZipEntryWriter until the archive is saved.
+         */
+        class DeflatedData
+        {
+        public:
+            DeflatedData() = default;
+            DeflatedData(const DeflatedData& other) = delete;
+            DeflatedData(DeflatedData&& other) noexcept
+                : Data(other.Data), Size(other.Size), UncompressedSize(other.UncompressedSize), Crc32(other.Crc32), IsValid(other.IsValid)
+            {
+                other.Data    = nullptr;
+                other.IsValid = false;
+            }
+            DeflatedData& operator=(const DeflatedData& other) = delete;
+            DeflatedData& operator=(DeflatedData&& other) = delete;
+            ~DeflatedData() { if (Data != nullptr) mz_free(Data); }
+
+            /**
+             * @brief Compress data into a raw deflate stream (no zlib header), as expected in a zip archive
+             * @param data The uncompressed entry data
+             * @return true on success, false if miniz failed to compress the data
+             */
+            bool Deflate(const ZipEntryData& data)
+            {
+                // ===== negative window bits = raw deflate stream
+                const int flags = static_cast<int>(tdefl_create_comp_flags_from_zip_params(MZ_DEFAULT_COMPRESSION, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY));
+                Data             = tdefl_compress_mem_to_heap(data.data(), data.size(), &Size, flags);
+                UncompressedSize = data.size();
+                Crc32            = static_cast<mz_uint32>(mz_crc32(MZ_CRC32_INIT, data.data(), data.size()));
+                IsValid          = (Data != nullptr);
+                return IsValid;
+            }
+
+            void*     Data             = nullptr; /**< The raw deflate stream, allocated by miniz. */
+            size_t    Size             = 0;       /**< The size of the raw deflate stream in bytes. */
+            size_t    UncompressedSize = 0;       /**< The size of the uncompressed data in bytes. */
+            mz_uint32 Crc32            = 0;       /**< The CRC-32 of the uncompressed data. */
+            bool      IsValid          = false;   /**< Flag indicating if Data holds a successfully compressed stream. */
+        };
+
         /**
          * @brief The Impl::ZipEntry class implements the functionality required for manipulating entries in a zip archive.
          * @details This is the implementation class. The ZipEntry class in the Zippy namespace implements the public interface.
@@ -268,6 +316,7 @@ namespace Zippy
                 }
 
                 m_EntryData  = result;
+                m_DeflatedData.reset();
                 m_IsModified = true;
             }
 
@@ -278,6 +327,7 @@ namespace Zippy
             void SetData(const ZipEntryData& data)
             {
                 m_EntryData  = data;
+                m_DeflatedData.reset();
                 m_IsModified = true;
             }
 
@@ -380,6 +430,7 @@ namespace Zippy
         private:
             ZipEntryInfo m_EntryInfo = ZipEntryInfo(); /**< The zip entry metadata. */
             ZipEntryData m_EntryData = ZipEntryData(); /**< The zip entry data. */
+            std::unique_ptr<DeflatedData> m_DeflatedData {}; /**< The compressed entry data, if the entry was written with a ZipEntryWriter. */
 
             bool m_IsModified = false; /**< Boolean flag indicating if the file has been modified since opening. */
 
@@ -642,6 +693,170 @@ namespace Zippy
 
         Impl::ZipEntry* m_ZipEntry; /**< A raw (non-owning) pointer to the implementation object. */
     };
+
+    /**
+     * @brief The ZipEntryReader class reads the data of a single entry sequentially, in chunks of a size chosen by the caller.
+     * @details Entries stored in the archive are decompressed incrementally, so that at no point the full uncompressed entry
+     * has to be held in memory. Entries that only exist in memory (added or modified since the archive was opened) are
+     * served from a copy of the in-memory data.
+     * @note A ZipEntryReader refers to the internal state of the ZipArchive that created it and must not be used after the
+     * archive has been closed or saved.
+     */
+    class ZipEntryReader
+    {
+    public:
+        /**
+         * @brief Constructor. Decompress the entry at index from a miniz archive.
+         * @param archive The (open) miniz archive.
+         * @param index The index of the entry in the archive.
+         */
+        ZipEntryReader(mz_zip_archive* archive, mz_uint index) : m_State(mz_zip_reader_extract_iter_new(archive, index, 0))
+        {
+            if (m_State == nullptr) throw ZipRuntimeError(mz_zip_get_error_string(archive->m_last_error));
+        }
+
+        /**
+         * @brief Constructor. Read an entry that only exists in memory.
+         * @param data The entry data.
+         */
+        explicit ZipEntryReader(ZipEntryData data) : m_Data(std::move(data)) {}
+
+        ZipEntryReader(const ZipEntryReader& other) = delete;
+        ZipEntryReader(ZipEntryReader&& other) noexcept
+            : m_State(other.m_State), m_Data(std::move(other.m_Data)), m_DataPos(other.m_DataPos)
+        {
+            other.m_State = nullptr;
+        }
+        ZipEntryReader& operator=(const ZipEntryReader& other) = delete;
+        ZipEntryReader& operator=(ZipEntryReader&& other) = delete;
+        ~ZipEntryReader() { if (m_State != nullptr) mz_zip_reader_extract_iter_free(m_State); }
+
+        /**
+         * @brief Read the next chunk of entry data.
+         * @param buffer The destination buffer.
+         * @param size The capacity of buffer in bytes.
+         * @return The number of bytes written to buffer. 0 indicates the end of the entry.
+         */
+        size_t Read(void* buffer, size_t size)
+        {
+            if (m_State == nullptr) {
+                const size_t count = (std::min)(size, m_Data.size() - m_DataPos);
+                std::copy_n(m_Data.begin() + static_cast<std::ptrdiff_t>(m_DataPos), count, static_cast<unsigned char*>(buffer));
+                m_DataPos += count;
+                return count;
+            }
+
+            const size_t count = mz_zip_reader_extract_iter_read(m_State, buffer, size);
+            if (count == 0 && m_State->status < 0) throw ZipRuntimeError("ZipEntryReader: failed to decompress entry data");
+            return count;
+        }
+
+    private:
+        mz_zip_reader_extract_iter_state* m_State {nullptr}; /**< The miniz decompression state, nullptr for in-memory entries. */
+        ZipEntryData                      m_Data {};         /**< The entry data, if the entry only exists in memory. */
+        size_t                            m_DataPos {0};     /**< The read position in m_Data. */
+    };
+
+    /**
+     * @brief The ZipEntryWriter class compresses the data of a new entry as it is written, so that the uncompressed entry never
+     * has to be held in memory.
+     * @details The data is compressed into a raw deflate stream in memory. Once complete, the entry is added to the archive with
+     * ZipArchive::CommitEntryWriter and the compressed data is stored as is when the archive is saved.
+     */
+    class ZipEntryWriter
+    {
+    public:
+        /**
+         * @brief Constructor. Set up a deflate compressor with the default compression level.
+         */
+        ZipEntryWriter() : m_Compressor(tdefl_compressor_alloc())
+        {
+            if (m_Compressor == nullptr) throw ZipRuntimeError("ZipEntryWriter: failed to allocate the deflate compressor");
+            m_Output = std::make_unique<Output>();
+
+            // ===== negative window bits = raw deflate stream
+            const int flags = static_cast<int>(tdefl_create_comp_flags_from_zip_params(MZ_DEFAULT_COMPRESSION, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY));
+            if (tdefl_init(m_Compressor, &ZipEntryWriter::PutBytes, m_Output.get(), flags) != TDEFL_STATUS_OKAY) {
+                tdefl_compressor_free(m_Compressor);
+                throw ZipRuntimeError("ZipEntryWriter: failed to initialize the deflate compressor");
+            }
+        }
+
+        ZipEntryWriter(const ZipEntryWriter& other) = delete;
+        ZipEntryWriter(ZipEntryWriter&& other) noexcept
+            : m_Compressor(other.m_Compressor), m_Output(std::move(other.m_Output)), m_Finished(other.m_Finished)
+        {
+            other.m_Compressor = nullptr;
+        }
+        ZipEntryWriter& operator=(const ZipEntryWriter& other) = delete;
+        ZipEntryWriter& operator=(ZipEntryWriter&& other) = delete;
+        ~ZipEntryWriter() { if (m_Compressor != nullptr) tdefl_compressor_free(m_Compressor); }
+
+        /**
+         * @brief Compress the next chunk of entry data.
+         * @param data The data to append to the entry.
+         * @param size The size of data in bytes.
+         */
+        void Write(const void* data, size_t size)
+        {
+            if (m_Compressor == nullptr || m_Finished) throw ZipLogicError("ZipEntryWriter: Write called on a finished writer");
+
+            m_Output->Data.Crc32 = static_cast<mz_uint32>(mz_crc32(m_Output->Data.Crc32, static_cast<const unsigned char*>(data), size));
+            m_Output->Data.UncompressedSize += size;
+            if (tdefl_compress_buffer(m_Compressor, data, size, TDEFL_NO_FLUSH) != TDEFL_STATUS_OKAY)
+                throw ZipRuntimeError("ZipEntryWriter: failed to compress entry data");
+        }
+
+        /**
+         * @brief Complete the deflate stream.
+         * @return The compressed entry data. The writer can not be used afterwards.
+         */
+        Impl::DeflatedData Finish()
+        {
+            if (m_Compressor == nullptr || m_Finished) throw ZipLogicError("ZipEntryWriter: Finish called on a finished writer");
+
+            if (tdefl_compress_buffer(m_Compressor, nullptr, 0, TDEFL_FINISH) != TDEFL_STATUS_DONE)
+                throw ZipRuntimeError("ZipEntryWriter: failed to compress entry data");
+            m_Finished             = true;
+            m_Output->Data.Size    = m_Output->Size;
+            m_Output->Data.IsValid = true;
+            return std::move(m_Output->Data);
+        }
+
+    private:
+        /**
+         * @brief The compressed output, kept on the heap as the compressor holds a pointer to it.
+         */
+        struct Output
+        {
+            Impl::DeflatedData Data {};        /**< The compressed data, Data.Data grows as the compressor emits output. */
+            size_t             Size {0};       /**< The number of bytes of compressed data. */
+            size_t             Capacity {0};   /**< The allocated size of Data.Data. */
+        };
+
+        /**
+         * @brief tdefl output callback: append compressed bytes to the output buffer.
+         */
+        static mz_bool PutBytes(const void* buffer, int length, void* user)
+        {
+            auto* output = static_cast<Output*>(user);
+            const size_t required = output->Size + static_cast<size_t>(length);
+            if (required > output->Capacity) {
+                const size_t capacity = (std::max)(required, output->Capacity * 2 + 65536);
+                void* data = MZ_REALLOC(output->Data.Data, capacity);    // released with mz_free by DeflatedData
+                if (data == nullptr) return MZ_FALSE;
+                output->Data.Data = data;
+                output->Capacity  = capacity;
+            }
+            std::copy_n(static_cast<const unsigned char*>(buffer), length, static_cast<unsigned char*>(output->Data.Data) + output->Size);
+            output->Size = required;
+            return MZ_TRUE;
+        }
+
+        tdefl_compressor*       m_Compressor {nullptr}; /**< The miniz deflate compressor. */
+        std::unique_ptr<Output> m_Output {};            /**< The compressed output. */
+        bool                    m_Finished {false};     /**< Flag indicating that Finish has been called. */
+    };
 }    // namespace Zippy
 
 namespace Zippy
@@ -843,6 +1058,33 @@ namespace Zippy
             return 0;
         }
 
+        /**
+         * @brief map filename read-only into memory as this->m_zipData, fall back to loadArchiveData if mapping fails
+         * @param filename map this file
+         * @return 0 on success, -1 on failure
+         */
+        int mapArchiveData(std::string filename)
+        {
+            m_zipData = OpenXLSX::mapFile(filename, m_zipSize);
+            if (m_zipData != nullptr) {
+                m_zipMapped = true;
+                return 0;
+            }
+            return loadArchiveData(filename);    // e.g. empty file or no mmap support on this platform
+        }
+
+        /**
+         * @brief release m_zipData, depending on whether it was mapped or allocated
+         */
+        void releaseArchiveData()
+        {
+            if (m_zipMapped) OpenXLSX::unmapFile(m_zipData, m_zipSize);
+            else             free(m_zipData);
+            m_zipData   = nullptr;    // prevent double-free
+            m_zipSize   = 0;
+            m_zipMapped = false;
+        }
+
         /**
          * @warning unicode filename support on Windows to be tested!
          * @brief Open an existing archive file with the given filename.
@@ -850,19 +1092,23 @@ namespace Zippy
          * ##### Implementation details
          * The archive file is opened and meta data for all the entries in the archive is loaded into memory.
          * @param fileName The filename of the archive to open.
+         * @param memoryMapped If true, map the archive file read-only into memory instead of reading it into a buffer.
+         * The setting is retained when Save re-opens the archive.
          * @note If more than one entry with the same name exists in the archive, only the newest one will be loaded.
          * When saving the archive, only the loaded entries will be kept; other entries with the same name will be deleted.
          */
-        void Open(const std::string& fileName)
+        void Open(const std::string& fileName, bool memoryMapped = false)
         {
             // ===== Open the archive file for reading.
             if (m_IsOpen) {
                 mz_zip_reader_end(&m_Archive);
+                releaseArchiveData();
             }
-            m_ArchivePath = fileName;
+            m_ArchivePath  = fileName;
+            m_MemoryMapped = memoryMapped;
 
             /* get buffer with zip archive inside */
-            if (loadArchiveData(fileName) < 0) {
+            if ((m_MemoryMapped ? mapArchiveData(fileName) : loadArchiveData(fileName)) < 0) {
                 using namespace std::literals::string_literals;
                 throw ZipRuntimeError("ZipArchive::Open: failed to load archive data from file "s + fileName);
             }
@@ -907,8 +1153,7 @@ namespace Zippy
         {
             if (IsOpen()) {
                 mz_zip_reader_end(&m_Archive);
-                free(m_zipData);
-                m_zipData = nullptr;   // prevent double-free
+                releaseArchiveData();  // unmaps or frees m_zipData, prevents double-free
             }
             m_ArchivePath = "";
             m_IsOpen = false;       // 2024-12-18: minor bugfix, m_IsOpen was not set to false
@@ -1107,10 +1352,12 @@ namespace Zippy
         /**
          * @brief Save the archive with a new name. The original archive will remain unchanged.
          * @param filename The new filename.
+         * @param compressionThreads The amount of worker threads used to compress modified entries. 0 = use
+         *  std::thread::hardware_concurrency, 1 = compress sequentially while writing the archive (default).
          * @note If no filename is provided, the file will be saved with the existing name, overwriting any existing data.
          * @throws ZipException A ZipException object is thrown if calls to miniz function fails.
          */
-        void Save(std::string filename = "")
+        void Save(std::string filename = "", unsigned int compressionThreads = 1)
         {
             if (!IsOpen()) throw ZipLogicError("Cannot call Save on empty ZipArchive object!");
 
@@ -1126,8 +1373,13 @@ namespace Zippy
             if (!mz_zip_writer_init_file(&tempArchive, tempPath.c_str(), 0))              // pull request #210
                 throw ZipRuntimeError(mz_zip_get_error_string(tempArchive.m_last_error)); //  "
 
+            // ===== Compress the modified entries up front on a worker pool, if more than one thread was requested.
+            //       The index of deflated corresponds to the index in m_ZipEntries, entries without data stay empty.
+            std::vector<Impl::DeflatedData> deflated = DeflateModifiedEntries(compressionThreads);
+
             // ===== Iterate through the ZipEntries and add entries to the temporary file
-            for (auto& file : m_ZipEntries) {
+            for (size_t i = 0; i < m_ZipEntries.size(); ++i) {
+                auto& file = m_ZipEntries[i];
                 if (file.IsDirectory()) continue;    // TODO: Ensure this is the right thing to do (Excel issue)
                 if (!file.IsModified()) {
                     if (!mz_zip_writer_add_from_zip_reader(&tempArchive, &m_Archive, file.Index())) {
@@ -1135,6 +1387,34 @@ namespace Zippy
                     }
                 }
 
+                else if (file.m_DeflatedData) {    // append the raw deflate stream produced by a ZipEntryWriter
+                    if (!mz_zip_writer_add_mem_ex(&tempArchive,
+                                                  file.GetName().c_str(),
+                                                  file.m_DeflatedData->Data,
+                                                  file.m_DeflatedData->Size,
+                                                  nullptr,
+                                                  0,
+                                                  MZ_DEFAULT_LEVEL | MZ_ZIP_FLAG_COMPRESSED_DATA,    // a negative level would drop the flag
+                                                  file.m_DeflatedData->UncompressedSize,
+                                                  file.m_DeflatedData->Crc32)) {
+                        throw ZipRuntimeError(mz_zip_get_error_string(tempArchive.m_last_error));
+                    }
+                }
+
+                else if (i < deflated.size() && deflated[i].IsValid) {    // append the precompressed raw deflate stream
+                    if (!mz_zip_writer_add_mem_ex(&tempArchive,
+                                                  file.GetName().c_str(),
+                                                  deflated[i].Data,
+                                                  deflated[i].Size,
+                                                  nullptr,
+                                                  0,
+                                                  MZ_DEFAULT_LEVEL | MZ_ZIP_FLAG_COMPRESSED_DATA,    // a negative level would drop the flag
+                                                  file.m_EntryData.size(),
+                                                  deflated[i].Crc32)) {
+                        throw ZipRuntimeError(mz_zip_get_error_string(tempArchive.m_last_error));
+                    }
+                }
+
                 else {
                     if (!mz_zip_writer_add_mem(&tempArchive,
                                                file.GetName().c_str(),
@@ -1160,7 +1440,7 @@ namespace Zippy
             Close();
             OpenXLSX::remove(filename.c_str());
             OpenXLSX::rename(tempPath.c_str(), filename.c_str()); // forward to function supporting unicode on Windows
-            Open(filename);
+            Open(filename, m_MemoryMapped);
         }
 
         /**
@@ -1202,6 +1482,8 @@ namespace Zippy
                 return name == entry.GetName();
             });
 
+            InflateDeflatedData(*result);
+
             // ===== If data has not been extracted from the archive (i.e., m_EntryData is empty),
             // ===== extract the data from the archive to the ZipEntry object.
             if (result->m_EntryData.empty()) {
@@ -1221,6 +1503,91 @@ namespace Zippy
             return ZipEntry(&*result);
         }
 
+        /**
+         * @brief Extract the data of an entry straight into a buffer obtained from allocate. Unlike GetEntry, the data
+         * of an unmodified entry is not kept in the ZipEntry object, so that the caller can own the only copy.
+         * @param name The name of the entry.
+         * @param size Receives the size of the entry data in bytes.
+         * @param allocate The function used to allocate the returned buffer. Ownership passes to the caller.
+         * @param deallocate The function used to release the buffer if extraction fails.
+         * @return A buffer of size bytes (allocated with at least 1 byte, even if size is 0).
+         */
+        void* GetEntryBuffer(const std::string& name, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*))
+        {
+            if (!IsOpen()) throw ZipLogicError("Cannot call GetEntryBuffer on empty ZipArchive object!");
+
+            // ===== Look up ZipEntry object.
+            auto result = std::find_if(m_ZipEntries.begin(), m_ZipEntries.end(), [&](const Impl::ZipEntry& entry) {
+                return name == entry.GetName();
+            });
+            if (result == m_ZipEntries.end()) throw ZipLogicError("GetEntryBuffer: archive does not contain entry " + name);
+            InflateDeflatedData(*result);
+
+            // ===== Entry data that is already in memory (modified or previously extracted) has to be copied,
+            //       otherwise decompress directly from the archive into the destination buffer
+            const bool inMemory = !result->m_EntryData.empty();
+            size = inMemory ? result->m_EntryData.size() : static_cast<size_t>(result->UncompressedSize());
+
+            void* buffer = allocate(size > 0 ? size : 1);
+            if (buffer == nullptr) throw ZipRuntimeError("GetEntryBuffer: failed to allocate " + std::to_string(size) + " bytes for entry " + name);
+
+            if (inMemory)
+                std::copy(result->m_EntryData.begin(), result->m_EntryData.end(), static_cast<unsigned char*>(buffer));
+            else if (size > 0 && !mz_zip_reader_extract_to_mem(&m_Archive, result->Index(), buffer, size, 0)) {
+                deallocate(buffer);
+                throw ZipRuntimeError(mz_zip_get_error_string(m_Archive.m_last_error));
+            }
+
+            return buffer;
+        }
+
+        /**
+         * @brief Open a sequential reader on the entry with the provided name.
+         * @param name The name of the entry.
+         * @return A ZipEntryReader that decompresses the entry data on demand.
+         */
+        ZipEntryReader OpenEntryReader(const std::string& name)
+        {
+            if (!IsOpen()) throw ZipLogicError("Cannot call OpenEntryReader on empty ZipArchive object!");
+
+            auto result = std::find_if(m_ZipEntries.begin(), m_ZipEntries.end(), [&](const Impl::ZipEntry& entry) {
+                return name == entry.GetName();
+            });
+            if (result == m_ZipEntries.end()) throw ZipLogicError("OpenEntryReader: archive does not contain entry " + name);
+
+            InflateDeflatedData(*result);
+            if (!result->m_EntryData.empty()) return ZipEntryReader(result->m_EntryData);
+            return ZipEntryReader(&m_Archive, result->Index());
+        }
+
+        /**
+         * @brief Open a writer for a new entry, that compresses the entry data as it is written.
+         * @return A ZipEntryWriter, to be passed to CommitEntryWriter when complete.
+         */
+        ZipEntryWriter OpenEntryWriter() const
+        {
+            if (!IsOpen()) throw ZipLogicError("Cannot call OpenEntryWriter on empty ZipArchive object!");
+            return ZipEntryWriter();
+        }
+
+        /**
+         * @brief Complete the data of a ZipEntryWriter and add it to the archive. The compressed data is written to the archive
+         * file without recompression when the archive is saved.
+         * @param name The name of the entry. If an entry with this name exists, it will be overwritten.
+         * @param writer The writer holding the entry data.
+         */
+        void CommitEntryWriter(const std::string& name, ZipEntryWriter& writer)
+        {
+            if (!IsOpen()) throw ZipLogicError("Cannot call CommitEntryWriter on empty ZipArchive object!");
+
+            auto deflated = std::make_unique<Impl::DeflatedData>(writer.Finish());
+            AddEntryImpl(name, ZipEntryData());
+            auto result = std::find_if(m_ZipEntries.begin(), m_ZipEntries.end(), [&](const Impl::ZipEntry& entry) {
+                return name == entry.GetName();
+            });
+            result->m_DeflatedData = std::move(deflated);
+        }
+
         /**
          * @brief Extract the entry with the provided name to the destination path.
          * @param name The name of the entry to extract.
@@ -1320,6 +1687,65 @@ namespace Zippy
         }
 
     private:
+        /**
+         * @brief Decompress the data of an entry written with a ZipEntryWriter into m_EntryData, so that it can be accessed like
+         * any other modified entry.
+         * @param entry The entry. Nothing is done if the entry has no compressed data.
+         */
+        static void InflateDeflatedData(Impl::ZipEntry& entry)
+        {
+            if (!entry.m_DeflatedData) return;
+
+            ZipEntryData data(entry.m_DeflatedData->UncompressedSize);
+            if (tinfl_decompress_mem_to_mem(data.data(), data.size(), entry.m_DeflatedData->Data, entry.m_DeflatedData->Size, 0) != data.size())
+                throw ZipRuntimeError("InflateDeflatedData: failed to decompress entry " + entry.GetName());
+            entry.m_EntryData = std::move(data);
+            entry.m_DeflatedData.reset();
+        }
+
+        /**
+         * @brief Compress all modified (non-directory, non-empty) entries into raw deflate streams, using a pool of worker threads.
+         * @param compressionThreads The requested amount of worker threads, 0 = std::thread::hardware_concurrency
+         * @return A vector with one element per entry in m_ZipEntries, or an empty vector if compression shall happen sequentially.
+         *  Elements for entries that were not compressed (or where compression failed) have IsValid == false and will be
+         *  compressed by the archive writer as before.
+         */
+        std::vector<Impl::DeflatedData> DeflateModifiedEntries(unsigned int compressionThreads)
+        {
+            std::vector<Impl::DeflatedData> deflated {};
+
+            // ===== Collect the indices of all entries that need compression
+            std::vector<size_t> jobs {};
+            for (size_t i = 0; i < m_ZipEntries.size(); ++i) {
+                const auto& file = m_ZipEntries[i];
+                if (!file.IsDirectory() && file.IsModified() && !file.m_EntryData.empty()) jobs.push_back(i);
+            }
+
+            if (compressionThreads == 0) compressionThreads = (std::max)(1u, std::thread::hardware_concurrency());
+            compressionThreads = static_cast<unsigned int>((std::min<size_t>)(compressionThreads, jobs.size()));
+            if (compressionThreads < 2) return deflated;    // nothing to gain from worker threads
+
+            deflated.resize(m_ZipEntries.size());
+
+            // ===== Each worker grabs the next job until none are left. Each job writes only its own element of deflated.
+            std::atomic<size_t> nextJob { 0 };
+            auto worker = [&]() {
+                for (size_t job = nextJob++; job < jobs.size(); job = nextJob++)
+                    deflated[jobs[job]].Deflate(m_ZipEntries[jobs[job]].m_EntryData);    // on failure, IsValid remains false
+            };
+
+            std::vector<std::thread> pool {};
+            pool.reserve(compressionThreads - 1);
+            for (unsigned int t = 1; t < compressionThreads; ++t) {
+                try { pool.emplace_back(worker); }
+                catch (const std::system_error&) { break; }    // could not spawn another thread: continue with the existing ones
+            }
+            worker();    // the calling thread participates as well
+            for (auto& thread : pool) thread.join();
+
+            return deflated;
+        }
+
         /**
          * @brief Add a new entry to the archive.
          * @param name The name of the entry to add.
@@ -1363,6 +1789,8 @@ namespace Zippy
     private:
         void           *m_zipData;    // the raw data of the unmodified source archive, TODO: (re-)set on ZipArchive::Open
         size_t          m_zipSize;    // the size in bytes of the unmodified source archive stored at m_zipData
+        bool            m_zipMapped    = false;           // true if m_zipData is a read-only file mapping rather than a malloc'ed buffer
+        bool            m_MemoryMapped = false;           /**< The open mode requested in Open, retained for re-opening in Save. */
         mz_zip_archive m_Archive     = mz_zip_archive(); /**< The struct used by miniz, to handle archive files. */
         std::string    m_ArchivePath = "";               /**< The path of the archive file. */
         bool           m_IsOpen      = false;            /**< A flag indicating if the file is currently open for reading and writing. */
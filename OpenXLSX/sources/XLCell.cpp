@@ -49,6 +49,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 // ===== OpenXLSX Includes ===== //
 #include "XLCell.hpp"
 #include "XLCellRange.hpp"
+#include "XLSheetBounds.hpp"
 #include "XLXmlParser.hpp"              // pugixml wrapper
 #include "utilities/XLUtilities.hpp"
 
@@ -58,7 +59,7 @@ using namespace OpenXLSX;
  * @details
  */
 XLCell::XLCell()
-    : m_cellNode(nullptr),
+    : m_cellNode(),
       m_sharedStrings(XLSharedStringsDefaulted),
       m_valueProxy(XLCellValueProxy(this, m_cellNode.get())),
       m_formulaProxy(XLFormulaProxy(this, m_cellNode.get()))
@@ -70,31 +71,34 @@ XLCell::XLCell()
  * If a cell XMLNode does not exist (i.e., the cell is empty), use the relevant constructor to create an XLCell
  * from a XLCellReference parameter.
  */
-XLCell::XLCell(const XMLNode& cellNode, const XLSharedStrings& sharedStrings)
-    : m_cellNode(std::make_unique<XMLNode>(cellNode)),
+XLCell::XLCell(const XMLNode& cellNode, const XLSharedStrings& sharedStrings, XLSheetBounds* sheetBounds)
+    : m_cellNode(cellNode),
       m_sharedStrings(sharedStrings),
       m_valueProxy(XLCellValueProxy(this, m_cellNode.get())),
-      m_formulaProxy(XLFormulaProxy(this, m_cellNode.get()))
+      m_formulaProxy(XLFormulaProxy(this, m_cellNode.get())),
+      m_sheetBounds(sheetBounds)
 {}
 
 /**
  * @details
  */
 XLCell::XLCell(const XLCell& other)
-    : m_cellNode(other.m_cellNode ? std::make_unique<XMLNode>(*other.m_cellNode) : nullptr),
+    : m_cellNode(other.m_cellNode),
       m_sharedStrings(other.m_sharedStrings),
       m_valueProxy(XLCellValueProxy(this, m_cellNode.get())),
-      m_formulaProxy(XLFormulaProxy(this, m_cellNode.get()))
+      m_formulaProxy(XLFormulaProxy(this, m_cellNode.get())),
+      m_sheetBounds(other.m_sheetBounds)
 {}
 
 /**
  * @details
  */
 XLCell::XLCell(XLCell&& other) noexcept
-    : m_cellNode(std::move(other.m_cellNode)),
+    : m_cellNode(other.m_cellNode),
       m_sharedStrings(std::move(other.m_sharedStrings)),
       m_valueProxy(XLCellValueProxy(this, m_cellNode.get())),
-      m_formulaProxy(XLFormulaProxy(this, m_cellNode.get()))
+      m_formulaProxy(XLFormulaProxy(this, m_cellNode.get())),
+      m_sheetBounds(other.m_sheetBounds)
 {}
 
 /**
@@ -121,10 +125,11 @@ XLCell& XLCell::operator=(const XLCell& other)
 XLCell& XLCell::operator=(XLCell&& other) noexcept
 {
     if (&other != this) {
-        m_cellNode      = std::move(other.m_cellNode);
+        m_cellNode      = other.m_cellNode;
         m_sharedStrings = std::move(other.m_sharedStrings);
         m_valueProxy    = XLCellValueProxy(this, m_cellNode.get());
         m_formulaProxy  = XLFormulaProxy(this, m_cellNode.get());    // pull request #160
+        m_sheetBounds   = other.m_sheetBounds;
     }
 
     return *this;
@@ -136,12 +141,13 @@ XLCell& XLCell::operator=(XLCell&& other) noexcept
 void XLCell::copyFrom(XLCell const& other)
 {
     using namespace std::literals::string_literals;
-    if (!m_cellNode) {
+    if (m_cellNode->empty()) {
         // copyFrom invoked by empty XLCell: create a new cell with reference & m_cellNode from other
-        m_cellNode      = std::make_unique<XMLNode>(*other.m_cellNode);
+        m_cellNode      = *other.m_cellNode;
         m_sharedStrings = other.m_sharedStrings; // TBD: check for XLSharedStringsDefaulted and avoid copy?
         m_valueProxy    = XLCellValueProxy(this, m_cellNode.get());
         m_formulaProxy  = XLFormulaProxy(this, m_cellNode.get());
+        m_sheetBounds   = other.m_sheetBounds;
         return;
     }
 
@@ -150,6 +156,8 @@ void XLCell::copyFrom(XLCell const& other)
 
     // ===== If m_cellNode points to a different XML node than other
     if ((&other != this) && (*other.m_cellNode != *m_cellNode)) {
+        markModified();
+        m_valueProxy.releaseSharedString();    // the shared string reference of the previous value is overwritten
         m_cellNode->remove_children();
 
         // ===== Copy all XML child nodes
@@ -166,19 +174,22 @@ void XLCell::copyFrom(XLCell const& other)
         // ===== Copy all XML attributes that are not the cell reference ("r")
         for (auto attr = other.m_cellNode->first_attribute(); not attr.empty(); attr = attr.next_attribute())
             if (strcmp(attr.name(), "r") != 0) m_cellNode->append_copy(attr);
+
+        // ===== The copied value is another reference to its shared string
+        if (const int32_t index = m_valueProxy.stringIndex(); index >= 0) m_sharedStrings.get().retainString(index);
     }
 }
 
 /**
  * @details
  */
-bool XLCell::empty() const { return (!m_cellNode) || m_cellNode->empty(); }
+bool XLCell::empty() const { return m_cellNode->empty(); }
 
 /**
  * @details
  * @todo 2024-08-10 TBD whether body can be replaced with !empty() (performance?)
  */
-XLCell::operator bool() const { return m_cellNode && (not m_cellNode->empty() ); } // ===== 2024-05-28: replaced explicit bool evaluation
+XLCell::operator bool() const { return not m_cellNode->empty(); } // ===== 2024-05-28: replaced explicit bool evaluation
 
 /**
  * @details This function returns a const reference to the cellReference property.
@@ -193,7 +204,8 @@ XLCell XLCell::offset(uint16_t rowOffset, uint16_t colOffset) const
     const XLCellReference offsetRef(cellReference().row() + rowOffset, cellReference().column() + colOffset);
     const auto            rownode  = getRowNode(m_cellNode->parent().parent(), offsetRef.row());
     const auto            cellnode = getCellNode(rownode, offsetRef.column());
-    return XLCell { cellnode, m_sharedStrings.get() };
+    if (m_sheetBounds != nullptr) m_sheetBounds->extend(offsetRef.column(), cellnode);    // the cell may have been created
+    return XLCell { cellnode, m_sharedStrings.get(), m_sheetBounds };
 }
 
 /**
@@ -220,6 +232,7 @@ size_t XLCell::cellFormat() const { return m_cellNode->attribute("s").as_uint(0)
 */
 bool XLCell::setCellFormat(size_t cellFormatIndex)
 {
+    markModified();
     XMLAttribute attr = m_cellNode->attribute("s");
     if (attr.empty() && not m_cellNode->empty())
         attr = m_cellNode->append_attribute("s");
@@ -288,6 +301,7 @@ const XLFormulaProxy& XLCell::formula() const { return m_formulaProxy; }
  */
 void  XLCell::clear(uint32_t keep)
 {
+    markModified();
     // ===== Clear attributes
     XMLAttribute attr = m_cellNode->first_attribute();
     while (not attr.empty()) {
@@ -338,3 +352,11 @@ const XLCellValueProxy& XLCell::value() const { return m_valueProxy; }
  * @post
  */
 bool XLCell::isEqual(const XLCell& lhs, const XLCell& rhs) { return *lhs.m_cellNode == *rhs.m_cellNode; }
+
+/**
+ * @details
+ */
+void XLCell::markModified() const
+{
+    if (m_sheetBounds != nullptr) m_sheetBounds->markModified();
+}
@@ -50,6 +50,8 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include "XLCellRange.hpp"
 #include "XLCellReference.hpp"
 #include "XLException.hpp"
+#include "XLRowIndex.hpp"
+#include "XLSheetBounds.hpp"
 #include "XLXmlParser.hpp"              // pugixml wrapper
 #include "utilities/XLUtilities.hpp"
 
@@ -107,14 +109,14 @@ namespace OpenXLSX { // utility functions findRowNode and findCellNode
         XMLNode cellNode = rowNode.last_child_of_type(pugi::node_element);
 
         // ===== If there are no cells in the current row, or the requested cell is beyond the last cell in the row...
-        if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber))
+        if (cellNode.empty() || (getCellColumn(cellNode) < columnNumber))
             return XMLNode{};
 
         // ===== If the requested node is closest to the end, start from the end and search backwards...
-        if (XLCellReference(cellNode.attribute("r").value()).column() - columnNumber < columnNumber) {
-            while (not cellNode.empty() && (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber))
+        if (getCellColumn(cellNode) - columnNumber < columnNumber) {
+            while (not cellNode.empty() && (getCellColumn(cellNode) > columnNumber))
                 cellNode = cellNode.previous_sibling_of_type(pugi::node_element);
-            if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber))
+            if (cellNode.empty() || (getCellColumn(cellNode) < columnNumber))
                 return XMLNode{};
         }
         // ===== Otherwise, start from the beginning
@@ -123,9 +125,9 @@ namespace OpenXLSX { // utility functions findRowNode and findCellNode
             cellNode = rowNode.first_child_of_type(pugi::node_element);
 
             // ===== It has been verified above that the requested columnNumber is <= the column number of the last node_element, therefore this loop will halt:
-            while (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)
+            while (getCellColumn(cellNode) < columnNumber)
                 cellNode = cellNode.next_sibling_of_type(pugi::node_element);
-            if (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber)
+            if (getCellColumn(cellNode) > columnNumber)
                 return XMLNode{};
         }
         return cellNode;
@@ -137,18 +139,19 @@ namespace OpenXLSX { // utility functions findRowNode and findCellNode
  * @details
  */
 XLCellIterator::XLCellIterator(const XLCellRange& cellRange, XLIteratorLocation loc, std::vector<XLStyleIndex> const * colStyles)
-    : m_dataNode(std::make_unique<XMLNode>(*cellRange.m_dataNode)),
+    : m_dataNode(*cellRange.m_dataNode),
       m_topLeft(cellRange.m_topLeft),
       m_bottomRight(cellRange.m_bottomRight),
       m_sharedStrings(cellRange.m_sharedStrings),
       m_endReached(false),
-      m_hintNode(std::make_unique<XMLNode>()),
+      m_hintNode(),
       m_hintRow(0),
       m_currentCell(),
       m_currentCellStatus(XLNotLoaded),
       m_currentRow(0),
       m_currentColumn(0),
-      m_colStyles(colStyles)
+      m_colStyles(colStyles),
+      m_sheetBounds(cellRange.m_sheetBounds)
 {
     if (loc == XLIteratorLocation::End)
         m_endReached = true;
@@ -171,18 +174,19 @@ XLCellIterator::~XLCellIterator() = default;
  * @details
  */
 XLCellIterator::XLCellIterator(const XLCellIterator& other)
-    : m_dataNode(std::make_unique<XMLNode>(*other.m_dataNode)),
+    : m_dataNode(other.m_dataNode),
       m_topLeft      (other.m_topLeft),
       m_bottomRight  (other.m_bottomRight),
       m_sharedStrings(other.m_sharedStrings),
       m_endReached   (other.m_endReached),
-      m_hintNode(std::make_unique<XMLNode>(*other.m_hintNode)),
+      m_hintNode(other.m_hintNode),
       m_hintRow      (other.m_hintRow),
       m_currentCell  (other.m_currentCell),
       m_currentCellStatus(other.m_currentCellStatus),
       m_currentRow   (other.m_currentRow),
       m_currentColumn(other.m_currentColumn),
-      m_colStyles    (other.m_colStyles)
+      m_colStyles    (other.m_colStyles),
+      m_sheetBounds  (other.m_sheetBounds)
 {}
 
 /**
@@ -196,18 +200,19 @@ XLCellIterator::XLCellIterator(XLCellIterator&& other) noexcept = default;
 XLCellIterator& XLCellIterator::operator=(const XLCellIterator& other)
 {
     if (&other != this) {
-        *m_dataNode     = *other.m_dataNode;
+        m_dataNode      =  other.m_dataNode;
         m_topLeft       =  other.m_topLeft;
         m_bottomRight   =  other.m_bottomRight;
         m_sharedStrings =  other.m_sharedStrings;
         m_endReached    =  other.m_endReached;
-        *m_hintNode     =  *other.m_hintNode;
+        m_hintNode      =  other.m_hintNode;
         m_hintRow       =  other.m_hintRow;
         m_currentCell   =  other.m_currentCell;
         m_currentCellStatus = other.m_currentCellStatus;
         m_currentRow    =  other.m_currentRow;
         m_currentColumn =  other.m_currentColumn;
         m_colStyles     =  other.m_colStyles;
+        m_sheetBounds   =  other.m_sheetBounds;
     }
 
     return *this;
@@ -236,9 +241,9 @@ void XLCellIterator::updateCurrentCell(bool createIfMissing)
 
     if (m_hintNode->empty()) {   // no hint has been established: fetch first cell node the "tedious" way
         if (createIfMissing)        // getCellNode / getRowNode create missing cells
-            m_currentCell = XLCell(getCellNode(getRowNode(*m_dataNode, m_currentRow), m_currentColumn, 0, *m_colStyles), m_sharedStrings.get());
+            m_currentCell = XLCell(getCellNode(getRowNode(*m_dataNode, m_currentRow), m_currentColumn, 0, *m_colStyles), m_sharedStrings.get(), m_sheetBounds);
         else                        // findCellNode / findRowNode return an empty cell for missing cells
-            m_currentCell = XLCell(findCellNode(findRowNode(*m_dataNode, m_currentRow), m_currentColumn), m_sharedStrings.get());
+            m_currentCell = XLCell(findCellNode(findRowNode(*m_dataNode, m_currentRow), m_currentColumn), m_sharedStrings.get(), m_sheetBounds);
     }
     else {
         // ===== Find or create, and fetch an XLCell at m_currentRow, m_currentColumn
@@ -247,7 +252,7 @@ void XLCellIterator::updateCurrentCell(bool createIfMissing)
             XMLNode cellNode = m_hintNode->next_sibling_of_type(pugi::node_element);
             uint16_t colNo = 0;
             while (not cellNode.empty()) {
-                colNo = XLCellReference(cellNode.attribute("r").value()).column();
+                colNo = getCellColumn(cellNode);
                 if(colNo >= m_currentColumn) break; // if desired cell was reached / passed, break before incrementing cellNode
                 cellNode = cellNode.next_sibling_of_type(pugi::node_element);
             }
@@ -258,7 +263,7 @@ void XLCellIterator::updateCurrentCell(bool createIfMissing)
                 setDefaultCellAttributes(cellNode, XLCellReference(m_currentRow, m_currentColumn).address(), m_hintNode->parent(),
                 /**/                      m_currentColumn, *m_colStyles);
             }
-            m_currentCell = XLCell(cellNode, m_sharedStrings.get()); // cellNode.empty() can be true if createIfMissing == false and cell is not found
+            m_currentCell = XLCell(cellNode, m_sharedStrings.get(), m_sheetBounds); // cellNode.empty() can be true if createIfMissing == false and cell is not found
         }
         else if (m_currentRow > m_hintRow) {
             // ===== Start from m_hintNode parent row and search forwards...
@@ -280,10 +285,10 @@ void XLCellIterator::updateCurrentCell(bool createIfMissing)
             else {                  // else: row found
                 if (createIfMissing) {
                     // ===== Pass the already known m_currentRow to getCellNode so that it does not have to be fetched again
-                    m_currentCell = XLCell(getCellNode (rowNode, m_currentColumn, m_currentRow, *m_colStyles), m_sharedStrings.get());
+                    m_currentCell = XLCell(getCellNode (rowNode, m_currentColumn, m_currentRow, *m_colStyles), m_sharedStrings.get(), m_sheetBounds);
                 }
                 else // ===== Do a "soft find" if a missing cell shall not be created
-                    m_currentCell = XLCell(findCellNode(rowNode, m_currentColumn), m_sharedStrings.get());
+                    m_currentCell = XLCell(findCellNode(rowNode, m_currentColumn), m_sharedStrings.get(), m_sheetBounds);
             }
         }
         else
@@ -293,8 +298,10 @@ void XLCellIterator::updateCurrentCell(bool createIfMissing)
     if (m_currentCell.empty())    // if cell is confirmed missing
         m_currentCellStatus = XLNoSuchCell; // mark this status for further calls to updateCurrentCell()
     else {
+        if (createIfMissing && m_sheetBounds != nullptr)    // the cell may have been created
+            m_sheetBounds->extend(m_currentColumn, *m_currentCell.m_cellNode);
         // ===== If the current cell exists, update the hints
-        m_hintNode   = std::make_unique<XMLNode>(*m_currentCell.m_cellNode);  // 2024-08-11: don't store a full XLCell, just the XMLNode, for better performance
+        m_hintNode   = m_currentCell.m_cellNode;    // 2024-08-11: don't store a full XLCell, just the XMLNode, for better performance
         m_hintRow    = m_currentRow;
         m_currentCellStatus = XLLoaded; // mark cell status for further calls to updateCurrentCell()
     }
@@ -425,3 +432,124 @@ std::string XLCellIterator::address() const
     uint16_t col = (m_endReached ? m_bottomRight.column() + 1 : m_currentColumn);
     return (m_endReached ? "END(" : "") + XLCellReference(row, col).address() + (m_endReached ? ")" : "");
 }
+
+/**
+ * @details Skip the rows above the range, then settle on the first existing cell within the range (or the end). With the row
+ *  index of the worksheet, the first row of the range is located without walking the rows above it.
+ */
+XLExistingCellIterator::XLExistingCellIterator(const XLCellRange& cellRange, XLIteratorLocation loc)
+    : m_topLeft(cellRange.m_topLeft),
+      m_bottomRight(cellRange.m_bottomRight),
+      m_sharedStrings(cellRange.m_sharedStrings),
+      m_sheetBounds(cellRange.m_sheetBounds),
+      m_currentCell(),
+      m_currentRow(0),
+      m_currentColumn(0),
+      m_endReached(true)
+{
+    if (loc == XLIteratorLocation::End) return;
+
+    XMLNode rowNode {};
+    if (cellRange.m_rowIndex != nullptr)
+        rowNode = cellRange.m_rowIndex->lowerBound(*cellRange.m_dataNode, m_topLeft.row());
+    else {
+        rowNode = cellRange.m_dataNode->first_child_of_type(pugi::node_element);
+        while (not rowNode.empty() && rowNode.attribute("r").as_ullong() < m_topLeft.row())
+            rowNode = rowNode.next_sibling_of_type(pugi::node_element);
+    }
+    seek(rowNode, rowNode.first_child_of_type(pugi::node_element));
+}
+
+/**
+ * @details rows and cells are stored in ascending order, so the search can stop at the first row below the range, and at the
+ *          first cell right of the range within each row
+ */
+void XLExistingCellIterator::seek(XMLNode rowNode, XMLNode cellNode)
+{
+    while (not rowNode.empty()) {
+        uint32_t rowNo = static_cast<uint32_t>(rowNode.attribute("r").as_ullong());
+        if (rowNo > m_bottomRight.row()) break;    // all following rows are below the range
+
+        for (; not cellNode.empty(); cellNode = cellNode.next_sibling_of_type(pugi::node_element)) {
+            uint16_t colNo = getCellColumn(cellNode);
+            if (colNo > m_bottomRight.column()) break;    // the rest of the row is right of the range
+            if (colNo >= m_topLeft.column()) {
+                m_currentCell   = XLCell(cellNode, m_sharedStrings.get(), m_sheetBounds);
+                m_currentRow    = rowNo;
+                m_currentColumn = colNo;
+                m_endReached    = false;
+                return;
+            }
+        }
+        rowNode  = rowNode.next_sibling_of_type(pugi::node_element);
+        cellNode = rowNode.first_child_of_type(pugi::node_element);
+    }
+
+    // ===== No further existing cell in range
+    m_currentCell   = XLCell{};
+    m_currentRow    = 0;
+    m_currentColumn = 0;
+    m_endReached    = true;
+}
+
+/**
+ * @details continue the search with the sibling following the current cell node
+ */
+XLExistingCellIterator& XLExistingCellIterator::operator++()
+{
+    if (m_endReached)
+        throw XLInputError("XLExistingCellIterator: tried to increment beyond end operator");
+
+    XMLNode cellNode = *m_currentCell.m_cellNode;
+    seek(cellNode.parent(), cellNode.next_sibling_of_type(pugi::node_element));
+    return *this;
+}
+
+/**
+ * @details
+ */
+XLExistingCellIterator XLExistingCellIterator::operator++(int)    // NOLINT
+{
+    auto oldIter(*this);
+    ++(*this);
+    return oldIter;
+}
+
+/**
+ * @details
+ */
+XLCell& XLExistingCellIterator::operator*()
+{
+    if (m_endReached)
+        throw XLInputError("XLExistingCellIterator: iterator should not be dereferenced when endReached() == true");
+    return m_currentCell;
+}
+
+/**
+ * @details
+ */
+XLExistingCellIterator::pointer XLExistingCellIterator::operator->() { return &(**this); }
+
+/**
+ * @details like XLCellIterator, iterators are compared by position only, without checking that they belong to the same range
+ */
+bool XLExistingCellIterator::operator==(const XLExistingCellIterator& rhs) const
+{
+    if (m_endReached || rhs.m_endReached) return m_endReached == rhs.m_endReached;
+    return m_currentRow == rhs.m_currentRow && m_currentColumn == rhs.m_currentColumn;
+}
+
+/**
+ * @details
+ */
+bool XLExistingCellIterator::operator!=(const XLExistingCellIterator& rhs) const { return !(*this == rhs); }
+
+/**
+ * @details
+ */
+XLCellReference XLExistingCellIterator::cellReference() const
+{
+    if (m_endReached)
+        throw XLInputError("XLExistingCellIterator::cellReference: beyond-the-end iterator has no cell reference");
+    return XLCellReference(m_currentRow, m_currentColumn);
+}
@@ -59,7 +59,9 @@ XLCellRange::XLCellRange()
       m_topLeft(XLCellReference("A1")),
       m_bottomRight(XLCellReference("A1")),
       m_sharedStrings(XLSharedStringsDefaulted),
-      m_columnStyles{}
+      m_columnStyles{},
+      m_sheetBounds(nullptr),
+      m_rowIndex(nullptr)
 {}
 
 /**
@@ -71,12 +73,16 @@ XLCellRange::XLCellRange()
 XLCellRange::XLCellRange(const XMLNode&         dataNode,
                          const XLCellReference& topLeft,
                          const XLCellReference& bottomRight,
-                         const XLSharedStrings& sharedStrings)
+                         const XLSharedStrings& sharedStrings,
+                         XLSheetBounds*         sheetBounds,
+                         XLRowIndex*            rowIndex)
     : m_dataNode(std::make_unique<XMLNode>(dataNode)),
       m_topLeft(topLeft),
       m_bottomRight(bottomRight),
       m_sharedStrings(sharedStrings),
-      m_columnStyles{}
+      m_columnStyles{},
+      m_sheetBounds(sheetBounds),
+      m_rowIndex(rowIndex)
 {
     if (m_topLeft.row() > m_bottomRight.row() || m_topLeft.column() > m_bottomRight.column()) {
         using namespace std::literals::string_literals;
@@ -93,7 +99,9 @@ XLCellRange::XLCellRange(const XLCellRange& other)
       m_topLeft(other.m_topLeft),
       m_bottomRight(other.m_bottomRight),
       m_sharedStrings(other.m_sharedStrings),
-      m_columnStyles(other.m_columnStyles)
+      m_columnStyles(other.m_columnStyles),
+      m_sheetBounds(other.m_sheetBounds),
+      m_rowIndex(other.m_rowIndex)
 {}
 
 /**
@@ -117,6 +125,8 @@ XLCellRange& XLCellRange::operator=(const XLCellRange& other)
         m_bottomRight   = other.m_bottomRight;
         m_sharedStrings = other.m_sharedStrings;
         m_columnStyles  = other.m_columnStyles;
+        m_sheetBounds   = other.m_sheetBounds;
+        m_rowIndex      = other.m_rowIndex;
     }
 
     return *this;
@@ -198,6 +208,11 @@ XLCellIterator XLCellRange::begin() const { return XLCellIterator(*this, XLItera
  */
 XLCellIterator XLCellRange::end() const { return XLCellIterator(*this, XLIteratorLocation::End, &m_columnStyles); }
 
+/**
+ * @details
+ */
+XLExistingCellRange XLCellRange::existingCells() const { return XLExistingCellRange(*this); }
+
 /**
  * @details
  * @pre
@@ -219,3 +234,18 @@ bool XLCellRange::setFormat(size_t cellFormatIndex)
             return false;                               // fail if any setCellFormat failed
     return true; // success if loop finished nominally
 }
+
+/**
+ * @details
+ */
+XLExistingCellRange::XLExistingCellRange(const XLCellRange& cellRange) : m_cellRange(cellRange) {}
+
+/**
+ * @details
+ */
+XLExistingCellIterator XLExistingCellRange::begin() const { return XLExistingCellIterator(m_cellRange, XLIteratorLocation::Begin); }
+
+/**
+ * @details
+ */
+XLExistingCellIterator XLExistingCellRange::end() const { return XLExistingCellIterator(m_cellRange, XLIteratorLocation::End); }
@@ -70,6 +70,36 @@ namespace
     {
         return !(row < 1 || row > OpenXLSX::MAX_ROWS || column < 1 || column > OpenXLSX::MAX_COLS);
     }
+
+    /**
+     * @brief Lookup table mapping 'A'..'Z' to 1..26 and every other character (including NUL) to 0
+     */
+    constexpr std::array<uint8_t, 256> columnLetterValues = [] {
+        std::array<uint8_t, 256> table {};
+        for (uint8_t letter = 0; letter < alphabetSize; ++letter) table[static_cast<uint8_t>('A' + letter)] = letter + 1;
+        return table;
+    }();
+
+    /**
+     * @brief Decode the column letters at the start of address
+     * @param address the NUL-terminated address
+     * @param end receives the position of the first character after the column letters
+     * @return the column number, or 0 if there are no letters, more than 3 letters or the column exceeds MAX_COLS
+     */
+    uint16_t decodeColumn(const char* address, const char*& end) noexcept
+    {
+        // ===== The NUL terminator maps to 0, so reading ahead stops at the end of the string without a length check
+        const uint32_t first  = columnLetterValues[static_cast<uint8_t>(address[0])];
+        if (first == 0) { end = address; return 0; }
+        const uint32_t second = columnLetterValues[static_cast<uint8_t>(address[1])];
+        if (second == 0) { end = address + 1; return static_cast<uint16_t>(first); }
+        const uint32_t third  = columnLetterValues[static_cast<uint8_t>(address[2])];
+        if (third == 0) { end = address + 2; return static_cast<uint16_t>(first * alphabetSize + second); }
+        end = address + 3;
+        const uint32_t column = (first * alphabetSize + second) * alphabetSize + third;
+        if (columnLetterValues[static_cast<uint8_t>(address[3])] != 0 || column > OpenXLSX::MAX_COLS) return 0;
+        return static_cast<uint16_t>(column);
+    }
 }    // namespace
 
 /**
@@ -406,3 +436,27 @@ XLCoordinates XLCellReference::coordinatesFromAddress(const std::string& address
     // return std::make_pair(rowAsNumber(rowPart), columnAsNumber(columnPart));
     */
 }
+
+/**
+ * @details Only the leading letters are inspected, the row part of the address is not validated.
+ */
+uint16_t XLCellReference::columnFromAddress(const char* address) noexcept
+{
+    const char* end = nullptr;
+    return decodeColumn(address, end);
+}
+
+/**
+ * @details Requires a valid column part followed by 1-7 digits and the end of the string.
+ */
+uint32_t XLCellReference::rowFromAddress(const char* address) noexcept
+{
+    const char* pos = nullptr;
+    if (decodeColumn(address, pos) == 0) return 0;
+
+    const char* digits = pos;
+    uint32_t    rowNo  = 0;
+    for (uint32_t digit = 0; pos - digits < 7 && (digit = static_cast<uint8_t>(*pos) - '0') < 10; ++pos) rowNo = rowNo * 10 + digit;
+    if (*pos != '\0' || rowNo > MAX_ROWS) return 0;    // rowNo is 0 if there were no digits or only zeros
+    return rowNo;
+}
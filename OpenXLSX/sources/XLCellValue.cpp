@@ -10,6 +10,7 @@
 #include "XLCell.hpp"
 #include "XLCellValue.hpp"
 #include "XLException.hpp"
+#include "XLNumberCodec.hpp"
 #include "XLXmlParser.hpp"              // pugixml wrapper
 
 using namespace OpenXLSX;
@@ -201,6 +202,12 @@ XLCellValueProxy& XLCellValueProxy::clear()
     assert(m_cellNode != nullptr);      // NOLINT
     assert(not m_cellNode->empty());    // NOLINT
 
+    // ===== Record the modification in the parent worksheet.
+    m_cell->markModified();
+
+    // ===== Release the shared string of the previous value (only relevant in case previous cell type was "s").
+    releaseSharedString();
+
     // ===== Remove the type attribute
     m_cellNode->remove_attribute("t");
 
@@ -227,6 +234,12 @@ XLCellValueProxy& XLCellValueProxy::setError(const std::string &error)
     assert(m_cellNode != nullptr);      // NOLINT
     assert(not m_cellNode->empty());    // NOLINT
 
+    // ===== Record the modification in the parent worksheet.
+    m_cell->markModified();
+
+    // ===== Release the shared string of the previous value (only relevant in case previous cell type was "s").
+    releaseSharedString();
+
     // ===== If the cell node doesn't have a type attribute, create it.
     if (!m_cellNode->attribute("t")) m_cellNode->append_attribute("t");
 
@@ -264,9 +277,7 @@ XLValueType XLCellValueProxy::type() const
 
     // ===== If a Type attribute is not present, but a value node is, the cell contains a number.
     if (m_cellNode->attribute("t").empty() || ((strcmp(m_cellNode->attribute("t").value(), "n") == 0) && not m_cellNode->child("v").empty())) {
-        if (const std::string numberString = m_cellNode->child("v").text().get();
-            numberString.find('.') != std::string::npos || numberString.find("E-") != std::string::npos || numberString.find("e-") != std::string::npos)
-            return XLValueType::Float;
+        if (XLNumberCodec::isFloatingPoint(m_cellNode->child("v").text().get())) return XLValueType::Float;
         return XLValueType::Integer;
     }
 
@@ -290,6 +301,24 @@ XLValueType XLCellValueProxy::type() const
     return XLValueType::Error;    // the m_typeAttribute has the ValueAsString "e"
 }
 
+/**
+ * @details
+ */
+XLCellValueProxy& XLCellValueProxy::setSharedString(const std::string& value)
+{
+    writeSharedString(m_cell->m_sharedStrings.get().getOrAppendString(value));
+    return *this;
+}
+
+/**
+ * @details
+ */
+XLCellValueProxy& XLCellValueProxy::setInlineString(const std::string& value)
+{
+    writeInlineString(value.c_str());
+    return *this;
+}
+
 /**
  * @details Get the value type of the current object, as a string representation.
  * @pre
@@ -325,6 +354,12 @@ void XLCellValueProxy::setInteger(int64_t numberValue) // NOLINT
     assert(m_cellNode != nullptr);      // NOLINT
     assert(not m_cellNode->empty());    // NOLINT
 
+    // ===== Record the modification in the parent worksheet.
+    m_cell->markModified();
+
+    // ===== Release the shared string of the previous value (only relevant in case previous cell type was "s").
+    releaseSharedString();
+
     // ===== If the cell node doesn't have a value child node, create it.
     if (m_cellNode->child("v").empty()) m_cellNode->append_child("v");
 
@@ -332,7 +367,9 @@ void XLCellValueProxy::setInteger(int64_t numberValue) // NOLINT
     m_cellNode->remove_attribute("t");
 
     // ===== Set the text of the value node.
-    m_cellNode->child("v").text().set(numberValue);
+    char number[XLMaxNumberChars];
+    XLNumberCodec::format(numberValue, number);
+    m_cellNode->child("v").text().set(number);
 
     // ===== Disable space preservation (only relevant for strings).
     m_cellNode->child("v").remove_attribute(m_cellNode->child("v").attribute("xml:space"));
@@ -353,6 +390,12 @@ void XLCellValueProxy::setBoolean(bool numberValue) // NOLINT
     assert(m_cellNode != nullptr);      // NOLINT
     assert(not m_cellNode->empty());    // NOLINT
 
+    // ===== Record the modification in the parent worksheet.
+    m_cell->markModified();
+
+    // ===== Release the shared string of the previous value (only relevant in case previous cell type was "s").
+    releaseSharedString();
+
     // ===== If the cell node doesn't have a type child node, create it.
     if (m_cellNode->attribute("t").empty()) m_cellNode->append_attribute("t");
 
@@ -386,14 +429,22 @@ void XLCellValueProxy::setFloat(double numberValue)
         assert(m_cellNode != nullptr);      // NOLINT
         assert(not m_cellNode->empty());    // NOLINT
 
+        // ===== Record the modification in the parent worksheet.
+        m_cell->markModified();
+
+        // ===== Release the shared string of the previous value (only relevant in case previous cell type was "s").
+        releaseSharedString();
+
         // ===== If the cell node doesn't have a value child node, create it.
         if (m_cellNode->child("v").empty()) m_cellNode->append_child("v");
 
         // ===== The type ("t") attribute is not required for number values.
         m_cellNode->remove_attribute("t");
 
-        // ===== Set the text of the value node.
-        m_cellNode->child("v").text().set(numberValue);
+        // ===== Set the text of the value node, in the shortest form that reads back to the identical value.
+        char number[XLMaxNumberChars];
+        XLNumberCodec::format(numberValue, number);
+        m_cellNode->child("v").text().set(number);
 
         // ===== Disable space preservation (only relevant for strings).
         m_cellNode->child("v").remove_attribute(m_cellNode->child("v").attribute("xml:space"));
@@ -414,11 +465,33 @@ void XLCellValueProxy::setFloat(double numberValue)
  * @post The underlying XMLNode has been updated correctly, representing a string value.
  */
 void XLCellValueProxy::setString(const char* stringValue) // NOLINT
+{
+    // ===== Get or create the index in the XLSharedStrings object, unless the string is to be stored inline.
+    const auto index = m_cell->m_sharedStrings.get().getOrAppendStringByPolicy(stringValue);    // single hash lookup
+    if (index >= 0)
+        writeSharedString(index);
+    else
+        writeInlineString(stringValue);
+}
+
+/**
+ * @details Set the cell to the shared string with the given index.
+ * @pre The m_cellNode must not be null, and must point to a valid XMLNode object.
+ * @post The underlying XMLNode has been updated correctly, representing a shared string value.
+ */
+void XLCellValueProxy::writeSharedString(int32_t index)
 {
     // ===== Check that the m_cellNode is valid.
     assert(m_cellNode != nullptr);      // NOLINT
     assert(not m_cellNode->empty());    // NOLINT
 
+    // ===== Record the modification in the parent worksheet.
+    m_cell->markModified();
+
+    // ===== Move the reference from the shared string of the previous value to the new shared string.
+    m_cell->m_sharedStrings.get().retainString(index);
+    releaseSharedString();
+
     // ===== If the cell node doesn't have a type child node, create it.
     if (m_cellNode->attribute("t").empty()) m_cellNode->append_attribute("t");
 
@@ -428,11 +501,6 @@ void XLCellValueProxy::setString(const char* stringValue) // NOLINT
     // ===== Set the type attribute.
     m_cellNode->attribute("t").set_value("s");
 
-    // ===== Get or create the index in the XLSharedStrings object.
-    const auto index = (m_cell->m_sharedStrings.get().stringExists(stringValue)
-    /**/                                                    ?          m_cell->m_sharedStrings.get().getStringIndex(stringValue)
-    /**/                                                             : m_cell->m_sharedStrings.get().appendString(stringValue));
-
     // ===== Set the text of the value node.
     m_cellNode->child("v").text().set(index);
 
@@ -454,6 +522,44 @@ void XLCellValueProxy::setString(const char* stringValue) // NOLINT
     //    }
 }
 
+/**
+ * @details Set the cell to an inline string, stored in an is node: <c r="C1" t="inlineStr"><is><t>An inline string</t></is></c>
+ * @pre The m_cellNode must not be null, and must point to a valid XMLNode object.
+ * @post The underlying XMLNode has been updated correctly, representing an inline string value.
+ */
+void XLCellValueProxy::writeInlineString(const char* stringValue)
+{
+    // ===== Check that the m_cellNode is valid.
+    assert(m_cellNode != nullptr);      // NOLINT
+    assert(not m_cellNode->empty());    // NOLINT
+
+    // ===== Record the modification in the parent worksheet.
+    m_cell->markModified();
+
+    // ===== Release the shared string of the previous value (only relevant in case previous cell type was "s").
+    releaseSharedString();
+
+    // ===== Set the type attribute.
+    if (m_cellNode->attribute("t").empty()) m_cellNode->append_attribute("t");
+    m_cellNode->attribute("t").set_value("inlineStr");
+
+    // ===== Remove the value node (only relevant in case previous cell type was not "inlineStr").
+    m_cellNode->remove_child("v");
+
+    // ===== Replace the contents of the is node with a single text node.
+    XMLNode isNode = m_cellNode->child("is");
+    if (isNode.empty())
+        isNode = m_cellNode->append_child("is");
+    else
+        isNode.remove_children();
+    XMLNode textNode = isNode.append_child("t");
+
+    const std::string_view s(stringValue);
+    if ((!s.empty()) && (s.front() == ' ' || s.back() == ' '))
+        textNode.append_attribute("xml:space").set_value("preserve");    // preserve spaces at begin/end of string
+    textNode.text().set(stringValue);
+}
+
 /**
  * @details Get a copy of the XLCellValue object for the cell. This is private helper function for returning an
  * XLCellValue object corresponding to the cell value.
@@ -471,10 +577,10 @@ XLCellValue XLCellValueProxy::getValue() const
             return XLCellValue().clear();
 
         case XLValueType::Float:
-            return XLCellValue { m_cellNode->child("v").text().as_double() };
+            return XLCellValue { XLNumberCodec::parseDouble(m_cellNode->child("v").text().get()) };
 
         case XLValueType::Integer:
-            return XLCellValue { m_cellNode->child("v").text().as_llong() };
+            return XLCellValue { XLNumberCodec::parseInteger(m_cellNode->child("v").text().get()) };
 
         case XLValueType::String:
             if (strcmp(m_cellNode->attribute("t").value(), "s") == 0)
@@ -515,5 +621,65 @@ int32_t XLCellValueProxy::stringIndex() const
 bool XLCellValueProxy::setStringIndex(int32_t newIndex)
 {
     if (newIndex < 0 || strcmp(m_cellNode->attribute("t").value(), "s") != 0) return false;  // cell value is not a shared string
+    m_cell->markModified();
+    m_cell->m_sharedStrings.get().retainString(newIndex);                                    // move the reference count
+    releaseSharedString();
     return m_cellNode->child("v").text().set(newIndex);                                      // set the shared string index directly
 }
+
+/**
+ * @details
+ */
+void XLCellValueProxy::releaseSharedString()
+{
+    if (const int32_t index = stringIndex(); index >= 0) m_cell->m_sharedStrings.get().releaseString(index);
+}
+
+/**
+ * @details
+ */
+bool XLCellValueProxy::getBoolean() const
+{
+    if (type() != XLValueType::Boolean) throw XLValueTypeError("XLCellValue object does not contain the requested type.");
+    return m_cellNode->child("v").text().as_bool();
+}
+
+/**
+ * @details
+ */
+int64_t XLCellValueProxy::getInteger() const
+{
+    if (type() != XLValueType::Integer) throw XLValueTypeError("XLCellValue object does not contain the requested type.");
+    return XLNumberCodec::parseInteger(m_cellNode->child("v").text().get());
+}
+
+/**
+ * @details Integers and booleans convert to double, an error is NaN - like XLCellValue::getDouble.
+ */
+double XLCellValueProxy::getFloat() const
+{
+    switch (type()) {
+        case XLValueType::Float:
+        case XLValueType::Integer:
+            return XLNumberCodec::parseDouble(m_cellNode->child("v").text().get());
+        case XLValueType::Boolean:
+            return m_cellNode->child("v").text().as_bool() ? 1.0 : 0.0;
+        case XLValueType::Error:
+            return std::nan("1");
+        default:
+            throw XLValueTypeError("XLCellValue object is not convertible to double.");
+    }
+}
+
+/**
+ * @details
+ */
+std::string XLCellValueProxy::getStringValue() const
+{
+    if (type() != XLValueType::String) throw XLValueTypeError("XLCellValue object does not contain the requested type.");
+    const char* typeAttribute = m_cellNode->attribute("t").value();
+    if (strcmp(typeAttribute, "s") == 0)
+        return m_cell->m_sharedStrings.get().getString(static_cast<uint32_t>(m_cellNode->child("v").text().as_ullong()));
+    if (strcmp(typeAttribute, "inlineStr") == 0) return m_cellNode->child("is").child("t").text().get();
+    return m_cellNode->child("v").text().get();    // "str"
+}
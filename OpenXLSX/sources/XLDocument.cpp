@@ -45,12 +45,19 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 // ===== External Includes ===== //
 #include <algorithm>
+#include <atomic>           // std::atomic
+#include <chrono>           // std::chrono::seconds
+#include <exception>        // std::exception_ptr
 #include <iostream>
+#include <mutex>            // std::mutex, std::lock_guard
+#include <string_view>
+#include <system_error>     // std::system_error
 #if defined(_WIN32)
     #include <random>       // TBD: is this still needed for anything? For what?
 #else
     #include <unistd.h>     // unlink
 #endif
+#include <thread>           // std::thread
 #include <vector>           // std::vector
 
 // ===== OpenXLSX Includes ===== //
@@ -67,6 +74,8 @@ using namespace OpenXLSX;
 namespace OpenXLSX {
     // define variable that depends on pugixml header file
     const unsigned int pugi_parse_settings = pugi::parse_default | pugi::parse_ws_pcdata; // TBD: | pugi::parse_comments
+    // ===== read-only: no formatting whitespace nodes, but keep whitespace-only values like <t> </t>. No CDATA, no attribute normalization
+    const unsigned int pugi_parse_settings_read_only = pugi::parse_escapes | pugi::parse_eol | pugi::parse_ws_pcdata_single;
 }    // namespace OpenXLSX
 
 namespace
@@ -425,6 +434,24 @@ namespace
         0x6b, 0x62, 0x6f, 0x6f, 0x6b, 0x2e, 0x78, 0x6d, 0x6c, 0x2e, 0x72, 0x65, 0x6c, 0x73, 0x50, 0x4b, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00,
         0x0a, 0x00, 0x0a, 0x00, 0x80, 0x02, 0x00, 0x00, 0x8c, 0x1b, 0x00, 0x00, 0x00, 0x00
     };
+
+    /**
+     * @brief check if the XML of a shared strings table has formatted strings: rich text runs (<r>) or phonetic properties
+     *  (<rPh>, <phoneticPr>), which the shared strings cache does not hold
+     * @param xml the XML text of xl/sharedStrings.xml
+     * @return true if any such element exists
+     */
+    bool hasFormattedStrings(const std::string& xml)
+    {
+        for (size_t pos = xml.find('<'); pos != std::string::npos; pos = xml.find('<', pos + 1)) {
+            const size_t nameEnd = xml.find_first_of(" \t\r\n/>", pos + 1);
+            if (nameEnd == std::string::npos) break;
+            std::string_view name(xml.data() + pos + 1, nameEnd - pos - 1);
+            if (const size_t colon = name.find(':'); colon != std::string_view::npos) name.remove_prefix(colon + 1);    // namespace
+            if (name == "r" || name == "rPh" || name == "phoneticPr") return true;
+        }
+        return false;
+    }
 }    // namespace
 
 XLDocument::XLDocument(const IZipArchive& zipArchive) : m_xmlSavingDeclaration{}, m_archive(zipArchive) {}
@@ -456,6 +483,72 @@ XLDocument::~XLDocument()
  */
 XLDocument& XLDocument::operator=(XLDocument&& other) noexcept = default;
 
+/**
+ * @details
+ */
+bool XLDocument::isReadOnly() const { return m_readOnly; }
+
+/**
+ * @details
+ */
+void XLDocument::rejectIfReadOnly(const std::string& operation) const
+{
+    using namespace std::literals::string_literals;
+    if (m_readOnly) throw XLException("XLDocument::"s + operation + ": the document was opened read-only"s);
+}
+
+/**
+ * @details The budget is enforced the next time a worksheet is loaded.
+ */
+void XLDocument::setMemoryBudget(uint64_t bytes) { m_memoryBudget = bytes; }
+
+/**
+ * @details
+ */
+uint64_t XLDocument::memoryBudget() const { return m_memoryBudget; }
+
+/**
+ * @details While deferred, the XML DOM (if it was ever loaded) misses the changes of the cache: rewrite it when leaving the mode.
+ */
+void XLDocument::setDeferredSharedStrings(bool deferred)
+{
+    m_deferSharedStrings = deferred;
+    if (!deferred && m_sharedStringsXmlOutdated) {
+        m_sharedStrings.rewriteXmlFromCache();
+        m_sharedStringsXmlOutdated = false;
+    }
+}
+
+/**
+ * @details
+ */
+bool XLDocument::deferredSharedStrings() const { return m_deferSharedStrings && !m_sharedStringsFormatted; }
+
+/**
+ * @details
+ */
+void XLDocument::setStringWritePolicy(const XLStringWritePolicy& policy) { m_stringWritePolicy = policy; }
+
+/**
+ * @details
+ */
+const XLStringWritePolicy& XLDocument::stringWritePolicy() const { return m_stringWritePolicy; }
+
+/**
+ * @details
+ */
+uint64_t XLDocument::evictionCount() const { return m_evictionCount; }
+
+/**
+ * @details
+ */
+uint64_t XLDocument::spillCount() const { return m_spillCount; }
+
+/**
+ * @details
+ */
+uint64_t XLDocument::reloadCount() const { return m_reloadCount; }
+
 /**
 * @details disable m_suppressWarnings
 */
@@ -473,11 +566,19 @@ void XLDocument::suppressWarnings() { m_suppressWarnings = true; }
  * - Unzip the contents of the package to the temporary folder.
  * - load the contents into the data structure for manipulation.
  */
-void XLDocument::open(const std::string& fileName)
+void XLDocument::open(const std::string& fileName) { open(fileName, XLOpenOptions {}); }
+
+/**
+ * @details As above. If options.preParseWorksheets is set, the selected worksheets are inflated and parsed on a
+ *  pool of worker threads before open returns, rather than serially on first access.
+ */
+void XLDocument::open(const std::string& fileName, const XLOpenOptions& options)
 {
     // Check if a document is already open. If yes, close it.
     if (m_archive.isOpen()) close(); // TBD: consider throwing if a file is already open.
     m_filePath = fileName;
+    m_readOnly      = options.readOnly;
+    m_parseSettings = m_readOnly ? pugi_parse_settings_read_only : pugi_parse_settings;
     m_archive.open(m_filePath);
 
     // ===== Add and open the Relationships and [Content_Types] files for the document level.
@@ -564,71 +665,64 @@ void XLDocument::open(const std::string& fileName)
         }
     }
 
-    // ===== Read shared strings table.
-    XMLDocument* sharedStrings = getXmlData("xl/sharedStrings.xml")->getXmlDocument();
-    if (not sharedStrings->document_element().attribute("uniqueCount").empty())
-        sharedStrings->document_element().remove_attribute(
-            "uniqueCount");    // pull request #192 -> remove count & uniqueCount as they are optional
-    if (not sharedStrings->document_element().attribute("count").empty())
-        sharedStrings->document_element().remove_attribute(
-            "count");          // pull request #192 -> remove count & uniqueCount as they are optional
-
-    XMLNode node =
-        sharedStrings->document_element().first_child_of_type(pugi::node_element);    // pull request #186: Skip non-element nodes in sst.
-    while (not node.empty()) {
-        // ===== Validate si node name.
-        using namespace std::literals::string_literals;
-        if (node.name() != "si"s) throw XLInputError("xl/sharedStrings.xml sst node name \""s + node.name() + "\" is not \"si\""s);
-
-        // ===== 2024-09-01 Refactored code to tolerate a mix of <t> and <r> tags within a shared string entry.
-        // This simplifies the loop while not doing any harm (obsolete inner loops for rich text and text elements removed).
-
-        // ===== Find first node_element child of si node.
-        XMLNode elem = node.first_child_of_type(pugi::node_element);
-        std::string result{}; // assemble a shared string entry here
-        while (not elem.empty()) {
-            // 2024-09-01: support a string composed of multiple <t> nodes in the same way as rich text <r> nodes, because LibreOffice accepts it
-
-            std::string elementName = elem.name(); // assign name to a string once, for string comparisons using operator==
-            if      (elementName == "t")               // If elem is a regular string
-                result += elem.text().get();               // append the tag value to result
-            else if (elementName == "r")               // If elem is rich text
-                result += elem.child("t").text().get();    // append the <t> node value to result
-            // ===== Ignore phonetic property tags
-            else if (elementName == "rPh" || elementName == "phoneticPr") {}
-            else                                       // For all other (unexpected) tags, throw an exception
-                throw XLInputError("xl/sharedStrings.xml si node \""s + elementName + "\" is none of \"r\", \"t\", \"rPh\", \"phoneticPr\""s);
-
-            elem = elem.next_sibling_of_type(pugi::node_element);    // advance to next child of <si>
-        }
-        // ===== Append an empty string even if elem.empty(), to keep the index aligned with the <si> tag index in the shared strings table <sst>
-        m_sharedStringCache.emplace_back(result); // 2024-09-01 TBC BUGFIX: previously, a shared strings table entry that had neither <t> nor
-        /**/                                      //     <r> nodes would not have appended to m_sharedStringCache, causing an index misalignment
-
-        node = node.next_sibling_of_type(pugi::node_element);
-    }
+    // ===== Read shared strings table: the entries are decoded on first use, and xl/sharedStrings.xml is only parsed into a DOM
+    //       when the shared strings get modified
+    std::string sharedStringsXml = extractXmlFromArchive("xl/sharedStrings.xml");
+    m_sharedStringsFormatted     = hasFormattedStrings(sharedStringsXml);    // see setDeferredSharedStrings
+    m_sharedStringCache.loadXml(std::move(sharedStringsXml));
+    m_sharedStringRefCounts.assign(m_sharedStringCache.size(), XLUnknownReferenceCount);    // counted by cleanupSharedStrings
 
     // ===== Open the workbook and document property items
     m_workbook       = XLWorkbook(getXmlData(workbookPath));
     // 2024-05-31: moved XLWorkbook object creation up in code worksheets info can be used for XLAppProperties generation from scratch
 
-    // ===== 2024-06-03: creating core and extended properties if they do not exist
-    execCommand(XLCommand(XLCommandType::CheckAndFixCoreProperties));      // checks & fixes consistency of docProps/core.xml related data
-    execCommand(XLCommand(XLCommandType::CheckAndFixExtendedProperties));  // checks & fixes consistency of docProps/app.xml related data
-
-    if (!hasXmlData("docProps/core.xml") || !hasXmlData("docProps/app.xml"))
-        throw XLInternalError("Failed to repair docProps (core.xml and/or app.xml)");
+    if (m_readOnly) {
+        // ===== Read-only: use the document properties as they are, if they exist (XLProperties tolerate a missing part)
+        if (hasXmlData("docProps/core.xml")) m_coreProperties = XLProperties(getXmlData("docProps/core.xml"));
+        if (hasXmlData("docProps/app.xml")) m_appProperties = XLAppProperties(getXmlData("docProps/app.xml"), m_workbook.xmlDocument());
+    }
+    else {
+        // ===== 2024-06-03: creating core and extended properties if they do not exist
+        execCommand(XLCommand(XLCommandType::CheckAndFixCoreProperties));      // checks & fixes consistency of docProps/core.xml related data
+        execCommand(XLCommand(XLCommandType::CheckAndFixExtendedProperties));  // checks & fixes consistency of docProps/app.xml related data
+
+        if (!hasXmlData("docProps/core.xml") || !hasXmlData("docProps/app.xml"))
+            throw XLInternalError("Failed to repair docProps (core.xml and/or app.xml)");
+
+        m_coreProperties = XLProperties(getXmlData("docProps/core.xml"));
+        m_appProperties  = XLAppProperties(getXmlData("docProps/app.xml"), m_workbook.xmlDocument());
+        // ===== 2024-09-02: ensure that all worksheets are contained in app.xml <TitlesOfParts> and reflected in <HeadingPairs> value for Worksheets
+        m_appProperties.alignWorksheets(m_workbook.sheetNames());
+    }
 
-    m_coreProperties = XLProperties(getXmlData("docProps/core.xml"));
-    m_appProperties  = XLAppProperties(getXmlData("docProps/app.xml"), m_workbook.xmlDocument());
-    // ===== 2024-09-02: ensure that all worksheets are contained in app.xml <TitlesOfParts> and reflected in <HeadingPairs> value for Worksheets
-    m_appProperties.alignWorksheets(m_workbook.sheetNames());
+    m_sharedStrings  = XLSharedStrings(getXmlData("xl/sharedStrings.xml"), &m_sharedStringCache, &m_sharedStringIndex, &m_sharedStringRefCounts);
+    if (!m_readOnly)    // read-only: construct XLStyles on first use, see styles()
+        m_styles     = XLStyles(getXmlData("xl/styles.xml"), m_suppressWarnings); // 2024-10-14: forward supress warnings setting to XLStyles
 
-    m_sharedStrings  = XLSharedStrings(getXmlData("xl/sharedStrings.xml"), &m_sharedStringCache);
-    m_styles         = XLStyles(getXmlData("xl/styles.xml"), m_suppressWarnings); // 2024-10-14: forward supress warnings setting to XLStyles
+    // ===== Optionally parse the (selected) worksheets up front, concurrently
+    if (options.preParseWorksheets) {
+        std::vector<XLXmlData*> parts {};
+        for (const auto& sheetName : options.preParseSheets.empty() ? m_workbook.worksheetNames() : options.preParseSheets)
+            parts.push_back(m_workbook.sheetXmlData(sheetName));
+        preParse(parts, options.preParseThreads);
+    }
 }
 
 
+/**
+ * @details Finished prefetches are dropped from m_prefetches, so that it does not grow while a pipeline walks many sheets.
+ */
+std::shared_future<void> XLDocument::prefetch(const std::string& sheetName)
+{
+    XLXmlData* part = m_workbook.sheetXmlData(sheetName);
+    m_prefetches.erase(std::remove_if(m_prefetches.begin(), m_prefetches.end(), [](const std::shared_future<void>& prefetch) {
+                           return prefetch.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+                       }),
+                       m_prefetches.end());
+    m_prefetches.push_back(part->loadAsync());
+    return m_prefetches.back();
+}
+
 /**
  * @details Create a new document. This is done by saving the data in XLTemplate.h in binary format.
  */
@@ -657,7 +751,17 @@ void XLDocument::create(const std::string& fileName, bool forceOverwrite)
     fwrite( templateData, templateSize, 1, outfile );
     fclose( outfile );
 
-    open(tempFileName);    // open the template archive from the temporary file
+    // ===== The temporary file is deleted right after opening - never memory-map it, as Windows can not delete a mapped file
+    const XLZipOpenMode openMode = m_archive.openMode();
+    m_archive.setOpenMode(XLZipOpenMode::Buffered);
+    try {
+        open(tempFileName);    // open the template archive from the temporary file
+    }
+    catch (...) {
+        m_archive.setOpenMode(openMode);
+        throw;
+    }
+    m_archive.setOpenMode(openMode);
     m_filePath = fileName; // re-configure the document file path to point to the desired fileName
 
     // 2025-05-04: the created (empty) archive is no longer saved implicitly, to remove the XLDocument dependency on nowide::ofstream
@@ -678,6 +782,7 @@ void XLDocument::create(const std::string& fileName) { create( fileName, XLForce
  */
 void XLDocument::close()
 {
+    waitForPrefetches();    // the parts are destroyed below
     if (m_archive.isValid()) m_archive.close();
     // m_suppressWarnings shall remain in the configured setting
 
@@ -686,7 +791,16 @@ void XLDocument::close()
     m_xmlSavingDeclaration = XLXmlSavingDeclaration();
 
     m_data.clear();
+    m_accessClock      = 0;    // m_memoryBudget shall remain in the configured setting
+    m_evictionCount    = 0;
+    m_spillCount       = 0;
+    m_reloadCount      = 0;
+    m_sharedStringIndex.clear();             // index views strings in m_sharedStringCache -> clear first
     m_sharedStringCache.clear();             // 2024-12-18 BUGFIX: clear shared strings cache - addresses issue #283
+    m_sharedStringsXmlOutdated = false;
+    m_sharedStringsFormatted   = false;
+    m_sharedStringRefCounts.clear();
+    m_sharedStringReferencesUncounted = false;
     m_sharedStrings    = XLSharedStrings();  //
 
     m_docRelationships = XLRelationships();
@@ -702,14 +816,14 @@ void XLDocument::close()
 /**
  * @details Save the document with the same name. The existing file will be overwritten.
  */
-void XLDocument::save() { saveAs(m_filePath, XLForceOverwrite); }
+void XLDocument::save(unsigned int compressionThreads) { saveAs(m_filePath, XLForceOverwrite, compressionThreads); }
 
 /**
  * @details Save the document with a new name. If present, the 'calcChain.xml file will be ignored. The reason for this
  * is that changes to the document may invalidate the calcChain.xml file. Deleting will force Excel to re-create the
  * file. This will happen automatically, without the user noticing.
  */
-void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite)
+void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite, unsigned int compressionThreads)
 {
     // 2024-07-26: prevent silent overwriting of existing files
     if (!forceOverwrite && pathExists(fileName)) {
@@ -717,14 +831,26 @@ void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite)
         throw XLException("XLDocument::saveAs: refusing to overwrite existing file "s + fileName);
     }
 
+    rejectIfReadOnly("saveAs");
     m_filePath = fileName;
+    waitForPrefetches();    // the archive is modified below
 
     // ===== Delete the calcChain.xml file in order to force re-calculation of the sheet
     // TODO: Is this the best way to do it? Maybe there is a flag that can be set, that forces re-calculalion.
     execCommand(XLCommand(XLCommandType::ResetCalcChain));
 
-    // ===== Add all xml items to archive and save the archive.
+    // ===== Release the shared strings that are no longer referenced by any cell
+    if (m_sharedStringReferencesUncounted) countSharedStringReferences();
+    m_sharedStrings.releaseUnusedStrings();
+
+    // ===== Deferred shared strings: write xl/sharedStrings.xml straight from the cache
+    if (m_sharedStringsXmlOutdated) writeDeferredSharedStrings();
+
+    // ===== Add all modified xml items to archive and save the archive.
     for (auto& item : m_data) {
+        if (!item.isDirty()) continue;    // not modified since open: keep the source archive entry, which is copied as-is
+        if (item.getXmlType() == XLContentType::Worksheet && !item.sheetBounds().hasExplicitDimension())
+            XLWorksheet(&item).setDimension();    // A1:lastCell(), see XLSheetBounds
         bool xmlIsStandalone = m_xmlSavingDeclaration.standalone_as_bool();
         if ((item.getXmlPath() == "docProps/core.xml")
           ||(item.getXmlPath() == "docProps/app.xml"))
@@ -732,7 +858,7 @@ void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite)
         m_archive.addEntry(item.getXmlPath(),
             item.getRawData(XLXmlSavingDeclaration(m_xmlSavingDeclaration.version(), m_xmlSavingDeclaration.encoding(),xmlIsStandalone)));
     }
-    m_archive.save(m_filePath);
+    m_archive.save(m_filePath, compressionThreads);
 }
 
 /**
@@ -885,6 +1011,7 @@ bool getAppVersion(const std::string& versionString, int& majorVersion, int& min
  */
 void XLDocument::setProperty(XLProperty prop, const std::string& value)    // NOLINT
 {
+    rejectIfReadOnly("setProperty");
     switch (prop) {
         case XLProperty::Application:
             m_appProperties.setProperty("Application", value);
@@ -998,7 +1125,11 @@ bool XLDocument::isOpen() const { return this->operator bool(); }
 /**
 * @details fetch a reference to m_styles
 */
-XLStyles& XLDocument::styles() { return m_styles; }
+XLStyles& XLDocument::styles()
+{
+    if (!m_styles.valid() && m_readOnly) m_styles = XLStyles(getXmlData("xl/styles.xml"), m_suppressWarnings);
+    return m_styles;
+}
 
 
 /**
@@ -1047,6 +1178,7 @@ XLRelationships XLDocument::sheetRelationships(uint16_t sheetXmlNo)
 
     if (!m_archive.hasEntry(relsFilename)) {
         // ===== Create the sheet relationships file within the archive
+        waitForPrefetches();    // the archive is modified below
         m_archive.addEntryAndCommit(relsFilename, "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>");  // empty XML file, class constructor will do the rest
         m_contentTypes.addOverride("/" + relsFilename, XLContentType::Relationships);                                // add content types entry
     }
@@ -1068,6 +1200,7 @@ XLVmlDrawing XLDocument::sheetVmlDrawing(uint16_t sheetXmlNo)
 
     if (!m_archive.hasEntry(vmlDrawingFilename)) {
         // ===== Create the sheet drawing file within the archive
+        waitForPrefetches();    // the archive is modified below
         m_archive.addEntryAndCommit(vmlDrawingFilename, "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>");  // empty XML file, class constructor will do the rest
         m_contentTypes.addOverride("/" + vmlDrawingFilename, XLContentType::VMLDrawing);                                   // add content types entry
     }
@@ -1089,6 +1222,7 @@ XLComments XLDocument::sheetComments(uint16_t sheetXmlNo)
 
     if (!m_archive.hasEntry(commentsFilename)) {
         // ===== Create the sheet comments file within the archive
+        waitForPrefetches();    // the archive is modified below
         m_archive.addEntryAndCommit(commentsFilename, "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>"); // empty XML file, class constructor will do the rest
         m_contentTypes.addOverride("/" + commentsFilename, XLContentType::Comments);                                    // add content types entry
     }
@@ -1110,6 +1244,7 @@ XLTables XLDocument::sheetTables(uint16_t sheetXmlNo)
 
     if (!m_archive.hasEntry(tablesFilename)) {
         // ===== Create the sheet tables file within the archive
+        waitForPrefetches();    // the archive is modified below
         m_archive.addEntryAndCommit(tablesFilename, "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>");   // empty XML file, class constructor will do the rest
         m_contentTypes.addOverride("/" + tablesFilename, XLContentType::Table);                                         // add content types entry
     }
@@ -1180,6 +1315,18 @@ bool XLDocument::validateSheetName(std::string sheetName, bool throwOnInvalid)
  */
 bool XLDocument::execCommand(const XLCommand& command)
 {
+    if (m_readOnly) {    // reject the commands that modify an opened document - the others are used while opening it
+        switch (command.type()) {
+            case XLCommandType::AddSharedStrings:
+            case XLCommandType::AddStyles:
+            case XLCommandType::CheckAndFixCoreProperties:
+            case XLCommandType::CheckAndFixExtendedProperties:
+                break;
+            default:
+                rejectIfReadOnly("execCommand");
+        }
+    }
+    waitForPrefetches();    // commands may modify the archive or remove parts
     switch (command.type()) {
         case XLCommandType::SetSheetName:
             validateSheetName(command.getParam<std::string>("newName"), THROW_ON_INVALID);
@@ -1323,6 +1470,7 @@ bool XLDocument::execCommand(const XLCommand& command)
                     /* xmlPath   */ sheetPath.substr(1),
                     /* xmlID     */ m_wbkRelationships.relationshipByTarget(sheetPath.substr(4)).id(),
                     /* xmlType   */ XLContentType::Worksheet);
+                m_sharedStrings.forgetReferenceCounts();    // the clone references shared strings without having retained them
             }
             else {
                 m_contentTypes.addOverride(sheetPath, XLContentType::Chartsheet);
@@ -1429,34 +1577,34 @@ XLQuery XLDocument::execQuery(const XLQuery& query) { return static_cast<const X
 void XLDocument::setSavingDeclaration(XLXmlSavingDeclaration const& savingDeclaration) { m_xmlSavingDeclaration = savingDeclaration; }
 
 /**
- * @details iterate over all worksheets, all rows, all columns and re-create the shared strings table in that order based on first use
+ * @details iterate over the existing cells of all worksheets and re-create the shared strings table in that order based on first use
  */
 void XLDocument::cleanupSharedStrings()
 {
     int32_t oldStringCount = m_sharedStringCache.size();
     std::vector< int32_t > indexMap(oldStringCount, -1);      // indexMap[ oldIndex ] :== newIndex, -1 = not yet assigned
+    XLSharedStringRefCounts newRefCounts(oldStringCount + 1, 0); // newRefCounts[ newIndex ] :== amount of cells referencing the string
     int32_t newStringCount = 1; // reserve index 0 for empty string, count here +1 for each unique shared string index that is in use in the worksheet
 
     unsigned int worksheetCount = m_workbook.worksheetCount();
     for (unsigned int wIndex = 1; wIndex <= worksheetCount; ++wIndex) {
         XLWorksheet wks = m_workbook.worksheet(wIndex);
-        XLCellRange cellRange = wks.range();
-        for (XLCellIterator cellIt = cellRange.begin(); cellIt != cellRange.end(); ++cellIt) {
-            if (!cellIt.cellExists()) continue; // prevent cell creation by access for non-existing cells
-
-            // ===== Cell exists: check for shared strings & update index as needed
-            XLCell& cell = *cellIt;
+        // ===== Visit the existing cells of the whole sheet - never creates any, and does not depend on lastCell
+        for (XLCell& cell : wks.range(XLCellReference(1, 1), XLCellReference(MAX_ROWS, MAX_COLS)).existingCells()) {
+            // ===== Check for shared strings & update index as needed
             if (cell.value().type() == XLValueType::String) {
                 XLCellValueProxy val = cell.value();
                 int32_t si = val.stringIndex();
+                if (si < 0) continue;    // inline string: not in the shared strings table
                 if (indexMap[si] == -1) {    // shared string was not yet flagged as "in use"
-                    if (m_sharedStringCache[si].length() > 0)  // if shared string is not empty
+                    if (not m_sharedStringCache.view(static_cast<size_t>(si)).empty())  // if shared string is not empty
                         indexMap[si] = newStringCount++;          // add this shared string to the end of the new cache being rewritten and increment the counter
                     else                                       // else
                         indexMap[si] = 0;                         // assign the hardcoded index 0 reserved for the empty string in newStringCache
                 }
                 if (indexMap[si] != si)   // if the index changed
                     val.setStringIndex(indexMap[si]);    // then update it for the cell
+                ++newRefCounts[indexMap[si]];
             }
         }
     }
@@ -1464,23 +1612,22 @@ void XLDocument::cleanupSharedStrings()
     // ===== After all cells have been reindexed, newStringCount is now the exact amount of remaining strings,
     //        and indexMap now contains the mapping to applied for reindexing.
 
-    // ===== Create a new shared strings cache.
-    std::vector<std::string> newStringCache(newStringCount);   // store the re-indexed strings here
-    // NOTE: newStringCache is vector because m_sharedStringCache may eventually be changed from std::deque to something else (std::map) for performance
-
-    newStringCache[0] = "";                                    // store empty string in first position
-    for (int32_t oldIdx = 0; oldIdx < oldStringCount; ++oldIdx) { // "steal" all std::strings that are still in use from existing string cache
-        if (int32_t newIdx = indexMap[oldIdx]; newIdx > 0)           // if string is still in use
-            newStringCache[newIdx] = std::move(m_sharedStringCache[oldIdx]); // NOTE: std::move invalidates the shared string cache -> not thread safe
-    }
-    m_sharedStringCache.clear(); // TBD: is this safe with strings that were std::move assigned to newStringCache?
-    // refill m_sharedStringCache cache from newStringCache
-    std::move(
-        newStringCache.begin(),
-        newStringCache.end(),
-        std::back_inserter(m_sharedStringCache)
-    );
-    if (static_cast<int32_t>(newStringCache.size()) != m_sharedStrings.rewriteXmlFromCache())
+    // ===== Create a new shared strings cache from the strings that are still in use.
+    std::vector<int32_t> oldIndices(newStringCount, -1);      // oldIndices[ newIndex ] :== oldIndex
+    for (int32_t oldIdx = 0; oldIdx < oldStringCount; ++oldIdx)
+        if (int32_t newIdx = indexMap[oldIdx]; newIdx > 0) oldIndices[newIdx] = oldIdx;
+
+    XLStringArena newStringCache {};
+    newStringCache.append("");                                 // store empty string in first position
+    for (int32_t newIdx = 1; newIdx < newStringCount; ++newIdx)
+        newStringCache.append(m_sharedStringCache.view(static_cast<size_t>(oldIndices[newIdx])));
+
+    m_sharedStringIndex.clear(); // index keys view the old cache, rewriteXmlFromCache will rebuild it
+    m_sharedStringCache = std::move(newStringCache);
+    newRefCounts.resize(newStringCount);
+    m_sharedStringRefCounts = std::move(newRefCounts); // all references have been counted: unused strings can now be released on save
+    m_sharedStringReferencesUncounted = false;
+    if (static_cast<int32_t>(m_sharedStringCache.size()) != m_sharedStrings.rewriteXmlFromCache())
         throw XLInternalError("XLDocument::cleanupSharedStrings: failed to rewrite shared string table - document would be corrupted");
 }
 
@@ -1488,6 +1635,25 @@ void XLDocument::cleanupSharedStrings()
 //           Protected Member Functions
 //----------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @details Reading the cells does not mark the worksheets as modified, so that the worksheets are still copied as-is on save
+ */
+void XLDocument::countSharedStringReferences()
+{
+    XLSharedStringRefCounts refCounts(m_sharedStringCache.size(), 0);
+    const unsigned int      worksheetCount = m_workbook.worksheetCount();
+    for (unsigned int wIndex = 1; wIndex <= worksheetCount; ++wIndex) {
+        XLWorksheet wks = m_workbook.worksheet(wIndex);
+        for (XLCell& cell : wks.range(XLCellReference(1, 1), XLCellReference(MAX_ROWS, MAX_COLS)).existingCells()) {
+            if (cell.value().type() != XLValueType::String) continue;
+            const int32_t si = cell.value().stringIndex();
+            if (si >= 0 && static_cast<size_t>(si) < refCounts.size()) ++refCounts[static_cast<size_t>(si)];    // not inline
+        }
+    }
+    m_sharedStringRefCounts           = std::move(refCounts);
+    m_sharedStringReferencesUncounted = false;
+}
+
 /**
  * @details
  */
@@ -1496,6 +1662,151 @@ std::string XLDocument::extractXmlFromArchive(const std::string& path)
     return (m_archive.hasEntry(path) ? m_archive.getEntry(path) : "");
 }
 
+/**
+ * @details The archive inflates the entry into a buffer allocated with the pugixml allocator, and pugixml parses that
+ *          buffer in place & takes ownership - the entry data is neither copied into a std::string nor kept by the archive
+ */
+size_t XLDocument::loadXmlFromArchive(const std::string& path, XMLDocument& xmlDocument)
+{
+    if (!m_archive.hasEntry(path)) {
+        xmlDocument.load_string("", m_parseSettings);
+        return 0;
+    }
+
+    size_t size   = 0;
+    void*  buffer = m_archive.getEntryBuffer(path, size, pugi::get_memory_allocation_function(), pugi::get_memory_deallocation_function());
+    xmlDocument.load_buffer_inplace_own(buffer, size, m_parseSettings);    // pugixml frees buffer, also on parse failure
+    return size;
+}
+
+/**
+ * @details Each worker grabs the next part until none are left. The parts parse into independent XMLDocument objects. The
+ *  extraction goes through XLZipArchive::getEntryBuffer, which takes the lock of the archive where the zip library needs
+ *  one - the same lock taken by background prefetches and entry streams, so no further synchronization is needed.
+ */
+void XLDocument::preParse(const std::vector<XLXmlData*>& parts, unsigned int threadCount)
+{
+    if (threadCount == 0) threadCount = (std::max)(1u, std::thread::hardware_concurrency());
+    threadCount = static_cast<unsigned int>((std::min<size_t>)(threadCount, parts.size()));
+
+    std::atomic<size_t> nextPart { 0 };
+    std::exception_ptr  firstError {};
+    std::mutex          errorMutex {};
+    auto worker = [&]() {
+        for (size_t part = nextPart++; part < parts.size(); part = nextPart++) {
+            try {
+                parts[part]->load();
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError) firstError = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool {};
+    if (threadCount > 1) pool.reserve(threadCount - 1);
+    for (unsigned int t = 1; t < threadCount; ++t) {
+        try { pool.emplace_back(worker); }
+        catch (const std::system_error&) { break; }    // could not spawn another thread: continue with the existing ones
+    }
+    worker();    // the calling thread participates as well
+    for (auto& thread : pool) thread.join();
+
+    if (firstError) std::rethrow_exception(firstError);
+}
+
+/**
+ * @details
+ */
+std::unique_ptr<XLZipEntryStream> XLDocument::openEntryStream(const std::string& path)
+{
+    if (!m_archive.hasEntry(path)) throw XLInternalError("Path does not exist in zip archive (" + path + ")");
+    return m_archive.openEntryStream(path);
+}
+
+/**
+ * @details
+ */
+std::unique_ptr<XLZipEntryWriter> XLDocument::openEntryWriter()
+{
+    rejectIfReadOnly("openEntryWriter");
+    waitForPrefetches();    // the entry is committed to the archive while the document is in use
+    return m_archive.openEntryWriter();
+}
+
+/**
+ * @details Each started load is also tracked by its XLXmlData, which rethrows a load error on first access: only wait here.
+ */
+void XLDocument::waitForPrefetches()
+{
+    for (const auto& prefetch : m_prefetches) prefetch.wait();
+    m_prefetches.clear();
+}
+
+/**
+ * @details The part is left unloaded, so that a later access loads the XML that was written, should the XML be needed again
+ */
+void XLDocument::writeDeferredSharedStrings()
+{
+    auto entry = m_archive.openEntryWriter();
+    m_sharedStrings.writeXmlFromCache(*entry, m_xmlSavingDeclaration);
+    entry->commit("xl/sharedStrings.xml");
+
+    XLXmlData* part = getXmlData("xl/sharedStrings.xml");
+    if (part->isLoaded()) {
+        part->unload();
+        part->m_evicted = false;    // not an eviction, keep the memory budget statistics clean
+    }
+    part->markClean();
+    m_sharedStringsXmlOutdated = false;
+}
+
+/**
+ * @details Only worksheets are subject to the budget: the other parts are referenced by long-lived objects (styles, shared
+ *  strings, relationships, ...) and are small in comparison. Parts with a pending background load are not counted yet.
+ *  Worksheets pinned by live cell, row or range objects are counted, but not evicted, so the budget may be exceeded.
+ */
+void XLDocument::enforceMemoryBudget(const XLXmlData* accessed)
+{
+    uint64_t                residentSize = 0;
+    std::vector<XLXmlData*> candidates {};
+    for (auto& part : m_data) {
+        if (part.getXmlType() != XLContentType::Worksheet || !part.m_resident || part.m_pendingLoad.valid()) continue;
+        residentSize += part.m_xmlSize;
+        if (&part != accessed && !(part.m_sheetBounds && part.m_sheetBounds->isPinned())) candidates.push_back(&part);
+    }
+    if (residentSize <= m_memoryBudget) return;
+
+    // ===== Evict the least recently used worksheets first
+    std::sort(candidates.begin(), candidates.end(), [](const XLXmlData* a, const XLXmlData* b) { return a->m_lastAccess < b->m_lastAccess; });
+    for (XLXmlData* part : candidates) {
+        if (residentSize <= m_memoryBudget) break;
+        residentSize -= part->m_xmlSize;
+        evict(*part);
+    }
+}
+
+/**
+ * @details A dirty part is compressed into the archive through an entry writer, replacing the original entry. From then
+ *  on the part is clean: it is reloaded from that entry, and saveAs copies the entry as-is. A part that was only read is
+ *  not dirty (see XLXmlData::isDirty) and is dropped, as the archive entry still holds the same content.
+ *  The parts of a read-only document are always dropped.
+ */
+void XLDocument::evict(XLXmlData& part)
+{
+    if (part.isDirty() && !m_readOnly) {    // changes to a read-only document can not be saved: drop them
+        const std::string xml   = part.getRawData(m_xmlSavingDeclaration);
+        auto              entry = openEntryWriter();
+        entry->write(xml.data(), xml.size());
+        entry->commit(part.getXmlPath());
+        part.markClean();
+        ++m_spillCount;
+    }
+    part.unload();
+    ++m_evictionCount;
+}
+
 /**
  * @details
  */
@@ -6,6 +6,7 @@
 #include <cassert>
 
 // ===== OpenXLSX Includes ===== //
+#include "XLCell.hpp"
 #include "XLFormula.hpp"
 #include "XLException.hpp"
 #include "XLXmlParser.hpp"              // pugixml wrapper
@@ -130,6 +131,9 @@ XLFormulaProxy& XLFormulaProxy::clear()
     assert(m_cellNode != nullptr);      // NOLINT
     assert(not m_cellNode->empty());    // NOLINT
 
+    // ===== Record the modification in the parent worksheet.
+    m_cell->markModified();
+
     // ===== Remove the value node.
     if (not m_cellNode->child("f").empty()) m_cellNode->remove_child("f");
     return *this;
@@ -145,6 +149,9 @@ void XLFormulaProxy::setFormulaString(const char* formulaString, bool resetValue
     assert(m_cellNode != nullptr);      // NOLINT
     assert(not m_cellNode->empty());    // NOLINT
 
+    // ===== Record the modification in the parent worksheet.
+    m_cell->markModified();
+
     if (formulaString[0] == 0) {    // if formulaString is empty
         m_cellNode->remove_child("f");    // clear the formula node
         return;                           // and exit
@@ -0,0 +1,144 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+// ===== External Includes ===== //
+#include <cmath>      // std::fabs, std::trunc
+#include <cstdio>     // snprintf
+#include <cstdlib>    // strtod, strtoll
+#include <cstring>    // strlen, strpbrk
+#include <limits>
+#if defined(CHARCONV_ENABLED) || defined(CHARCONV_FLOAT_ENABLED)
+#    include <charconv>
+#endif
+
+// ===== OpenXLSX Includes ===== //
+#include "XLNumberCodec.hpp"
+
+using namespace OpenXLSX;
+
+namespace
+{
+    /**
+     * @brief skip the leading whitespace and an optional '+' sign, which std::from_chars does not accept
+     */
+    const char* skipNumberPrefix(const char* str)
+    {
+        while (*str == ' ' || *str == '\t' || *str == '\r' || *str == '\n') ++str;
+        if (*str == '+') ++str;
+        return str;
+    }
+}    // namespace
+
+/**
+ * @details Whole numbers below 1e17 are written in fixed notation, so that e.g. 1000000.0 becomes "1000000" and not "1e+06".
+ */
+size_t XLNumberCodec::format(double value, char* buffer)
+{
+    const bool wholeNumber = (std::fabs(value) < 1e17) && (std::trunc(value) == value);
+#ifdef CHARCONV_FLOAT_ENABLED
+    const auto result = wholeNumber ? std::to_chars(buffer, buffer + XLMaxNumberChars - 1, value, std::chars_format::fixed)
+                                    : std::to_chars(buffer, buffer + XLMaxNumberChars - 1, value);
+    *result.ptr = '\0';
+    return static_cast<size_t>(result.ptr - buffer);
+#else
+    // ===== Without floating point charconv: 15 significant digits are enough for most values, otherwise use 17
+    if (wholeNumber) return static_cast<size_t>(snprintf(buffer, XLMaxNumberChars, "%.0f", value));
+    int length = snprintf(buffer, XLMaxNumberChars, "%.15g", value);
+    if (strtod(buffer, nullptr) != value) length = snprintf(buffer, XLMaxNumberChars, "%.17g", value);
+    return static_cast<size_t>(length);
+#endif
+}
+
+/**
+ * @details
+ */
+size_t XLNumberCodec::format(int64_t value, char* buffer)
+{
+#ifdef CHARCONV_ENABLED
+    const auto result = std::to_chars(buffer, buffer + XLMaxNumberChars - 1, value);
+    *result.ptr = '\0';
+    return static_cast<size_t>(result.ptr - buffer);
+#else
+    return static_cast<size_t>(snprintf(buffer, XLMaxNumberChars, "%lld", static_cast<long long>(value)));
+#endif
+}
+
+/**
+ * @details An exponent makes a number floating point even without a decimal point, e.g. "1e+20" which does not fit an int64_t.
+ */
+bool XLNumberCodec::isFloatingPoint(const char* str) { return strpbrk(str, ".eE") != nullptr; }
+
+/**
+ * @details
+ */
+double XLNumberCodec::parseDouble(const char* str)
+{
+    str = skipNumberPrefix(str);
+#ifdef CHARCONV_FLOAT_ENABLED
+    double value = 0.0;
+    const auto result = std::from_chars(str, str + strlen(str), value);
+    if (result.ec == std::errc::result_out_of_range) return strtod(str, nullptr);    // let strtod decide between 0, denormal & inf
+    return result.ec == std::errc() ? value : 0.0;
+#else
+    return strtod(str, nullptr);
+#endif
+}
+
+/**
+ * @details A value that does not fit into int64_t is saturated, like pugixml's as_llong does.
+ */
+int64_t XLNumberCodec::parseInteger(const char* str)
+{
+    str = skipNumberPrefix(str);
+#ifdef CHARCONV_ENABLED
+    int64_t value = 0;
+    const auto result = std::from_chars(str, str + strlen(str), value);
+    if (result.ec == std::errc::result_out_of_range)
+        return *str == '-' ? (std::numeric_limits<int64_t>::min)() : (std::numeric_limits<int64_t>::max)();
+    return result.ec == std::errc() ? value : 0;
+#else
+    return static_cast<int64_t>(strtoll(str, nullptr, 10));    // saturates on overflow
+#endif
+}
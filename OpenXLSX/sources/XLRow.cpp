@@ -50,6 +50,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include "XLCellIterator.hpp"
 #include "XLCellReference.hpp"
 #include "XLRow.hpp"
+#include "XLSheetBounds.hpp"
 #include "XLStyles.hpp"                 // XLDefaultCellFormat
 #include "XLXmlParser.hpp"              // pugixml wrapper
 #include "utilities/XLUtilities.hpp"
@@ -63,7 +64,7 @@ namespace OpenXLSX
      * @post
      */
     XLRow::XLRow()
-        : m_rowNode(nullptr),
+        : m_rowNode(),
           m_sharedStrings(XLSharedStringsDefaulted),
           m_rowDataProxy(this, m_rowNode.get())
     {}
@@ -74,10 +75,11 @@ namespace OpenXLSX
      * @pre
      * @post
      */
-    XLRow::XLRow(const XMLNode& rowNode, const XLSharedStrings& sharedStrings)
-        : m_rowNode(std::make_unique<XMLNode>(rowNode)),
+    XLRow::XLRow(const XMLNode& rowNode, const XLSharedStrings& sharedStrings, XLSheetBounds* sheetBounds)
+        : m_rowNode(rowNode),
           m_sharedStrings(sharedStrings),
-          m_rowDataProxy(this, m_rowNode.get())
+          m_rowDataProxy(this, m_rowNode.get()),
+          m_sheetBounds(sheetBounds)
     {}
 
     /**
@@ -86,9 +88,10 @@ namespace OpenXLSX
      * @post
      */
     XLRow::XLRow(const XLRow& other)
-        : m_rowNode(other.m_rowNode ? std::make_unique<XMLNode>(*other.m_rowNode) : nullptr),
+        : m_rowNode(other.m_rowNode),
           m_sharedStrings(other.m_sharedStrings),
-          m_rowDataProxy(this, m_rowNode.get())
+          m_rowDataProxy(this, m_rowNode.get()),
+          m_sheetBounds(other.m_sheetBounds)
     {}
 
     /**
@@ -98,9 +101,10 @@ namespace OpenXLSX
      * @post
      */
     XLRow::XLRow(XLRow&& other) noexcept
-        : m_rowNode(std::move(other.m_rowNode)),
+        : m_rowNode(other.m_rowNode),
           m_sharedStrings(std::move(other.m_sharedStrings)),
-          m_rowDataProxy(this, m_rowNode.get())
+          m_rowDataProxy(this, m_rowNode.get()),
+          m_sheetBounds(other.m_sheetBounds)
     {}
 
     /**
@@ -133,9 +137,10 @@ namespace OpenXLSX
     XLRow& XLRow::operator=(XLRow&& other) noexcept
     {
         if (&other != this) {
-            m_rowNode       = std::move(other.m_rowNode);
+            m_rowNode       = other.m_rowNode;
             m_sharedStrings = std::move(other.m_sharedStrings);
             m_rowDataProxy  = XLRowDataProxy(this, m_rowNode.get());
+            m_sheetBounds   = other.m_sheetBounds;
         }
         return *this;
     }
@@ -143,12 +148,12 @@ namespace OpenXLSX
     /**
      * @details
      */
-    bool XLRow::empty() const { return (!m_rowNode) || m_rowNode->empty(); }
+    bool XLRow::empty() const { return m_rowNode->empty(); }
 
     /**
      * @details
      */
-    XLRow::operator bool() const { return m_rowNode && (not m_rowNode->empty() ); }
+    XLRow::operator bool() const { return not m_rowNode->empty(); }
 
     /**
      * @details Returns the m_height member by getValue.
@@ -168,6 +173,8 @@ namespace OpenXLSX
      */
     void XLRow::setHeight(float height)    // NOLINT
     {
+        markModified();
+
         // Set the 'ht' attribute for the Cell. If it does not exist, create it.
         if (m_rowNode->attribute("ht").empty())
             m_rowNode->append_attribute("ht") = height;
@@ -198,6 +205,8 @@ namespace OpenXLSX
      */
     void XLRow::setDescent(float descent)
     {
+        markModified();
+
         // Set the 'x14ac:dyDescent' attribute. If it does not exist, create it.
         if (m_rowNode->attribute("x14ac:dyDescent").empty())
             m_rowNode->append_attribute("x14ac:dyDescent") = descent;
@@ -219,6 +228,8 @@ namespace OpenXLSX
      */
     void XLRow::setHidden(bool state)    // NOLINT
     {
+        markModified();
+
         // Set the 'hidden' attribute. If it does not exist, create it.
         if (m_rowNode->attribute("hidden").empty())
             m_rowNode->append_attribute("hidden") = static_cast<int>(state);
@@ -244,7 +255,7 @@ namespace OpenXLSX
     {
         const auto node = m_rowNode->last_child_of_type(pugi::node_element);
         if (node.empty()) return 0;
-        return XLCellReference(node.attribute("r").value()).column();
+        return getCellColumn(node);
     }
 
     /**
@@ -270,7 +281,7 @@ namespace OpenXLSX
     {
         const XMLNode node = m_rowNode->last_child_of_type(pugi::node_element);
         if (node.empty()) return XLRowDataRange();    // empty range
-        return XLRowDataRange(*m_rowNode, 1, XLCellReference(node.attribute("r").value()).column(), m_sharedStrings.get());
+        return XLRowDataRange(*m_rowNode, 1, getCellColumn(node), m_sharedStrings.get(), m_sheetBounds);
     }
 
     /**
@@ -278,7 +289,7 @@ namespace OpenXLSX
      * @pre
      * @post
      */
-    XLRowDataRange XLRow::cells(uint16_t cellCount) const { return XLRowDataRange(*m_rowNode, 1, cellCount, m_sharedStrings.get()); }
+    XLRowDataRange XLRow::cells(uint16_t cellCount) const { return XLRowDataRange(*m_rowNode, 1, cellCount, m_sharedStrings.get(), m_sheetBounds); }
 
     /**
      * @details
@@ -287,7 +298,7 @@ namespace OpenXLSX
      */
     XLRowDataRange XLRow::cells(uint16_t firstCell, uint16_t lastCell) const
     {
-        return XLRowDataRange(*m_rowNode, firstCell, lastCell, m_sharedStrings.get());
+        return XLRowDataRange(*m_rowNode, firstCell, lastCell, m_sharedStrings.get(), m_sheetBounds);
     }
 
     /**
@@ -300,15 +311,15 @@ namespace OpenXLSX
         XMLNode cellNode = m_rowNode->last_child_of_type(pugi::node_element);
 
         // ===== If there are no cells in the current row, or the requested cell is beyond the last cell in the row...
-        if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber))
+        if (cellNode.empty() || (getCellColumn(cellNode) < columnNumber))
             return XLCell{}; // fail
 
         // ===== If the requested node is closest to the end, start from the end and search backwards...
-        if (XLCellReference(cellNode.attribute("r").value()).column() - columnNumber < columnNumber) {
-            while (not cellNode.empty() && (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber))
+        if (getCellColumn(cellNode) - columnNumber < columnNumber) {
+            while (not cellNode.empty() && (getCellColumn(cellNode) > columnNumber))
                 cellNode = cellNode.previous_sibling_of_type(pugi::node_element);
             // ===== If the backwards search failed to locate the requested cell
-            if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber))
+            if (cellNode.empty() || (getCellColumn(cellNode) < columnNumber))
                 return XLCell{}; // fail
         }
         // ===== Otherwise, start from the beginning
@@ -317,13 +328,13 @@ namespace OpenXLSX
             cellNode = m_rowNode->first_child_of_type(pugi::node_element);
 
             // ===== It has been verified above that the requested columnNumber is <= the column number of the last node_element, therefore this loop will halt:
-            while (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)
+            while (getCellColumn(cellNode) < columnNumber)
                 cellNode = cellNode.next_sibling_of_type(pugi::node_element);
             // ===== If the forwards search failed to locate the requested cell
-            if (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber)
+            if (getCellColumn(cellNode) > columnNumber)
                 return XLCell{}; // fail
         }
-        return XLCell(cellNode, m_sharedStrings.get());
+        return XLCell(cellNode, m_sharedStrings.get(), m_sheetBounds);
     }
 
     /**
@@ -337,6 +348,7 @@ namespace OpenXLSX
      */
     bool XLRow::setFormat(XLStyleIndex cellFormatIndex)
     {
+        markModified();
         XMLAttribute customFormatAtt = m_rowNode->attribute("customFormat");
         if (cellFormatIndex != XLDefaultCellFormat) {
             if (customFormatAtt.empty()) {
@@ -364,15 +376,16 @@ namespace OpenXLSX
 
     bool XLRow::isEqual(const XLRow& lhs, const XLRow& rhs)
     {
-        // 2024-05-28 BUGFIX: (!lhs.m_rowNode && rhs.m_rowNode) was not evaluated, triggering a segmentation fault on dereferencing
-        if (static_cast<bool>(lhs.m_rowNode) != static_cast<bool>(rhs.m_rowNode)) return false;
-        // ===== If execution gets here, row nodes are BOTH valid or BOTH invalid / empty
-        if (not lhs.m_rowNode) return true;    // checking one for being empty is enough to know both are empty
-        return *lhs.m_rowNode == *rhs.m_rowNode;
+        return *lhs.m_rowNode == *rhs.m_rowNode;    // m_rowNode is never null, an empty XLRow holds an empty XMLNode
     }
 
     bool XLRow::isLessThan(const XLRow& lhs, const XLRow& rhs) { return *lhs.m_rowNode < *rhs.m_rowNode; }
 
+    void XLRow::markModified() const
+    {
+        if (m_sheetBounds != nullptr) m_sheetBounds->markModified();
+    }
+
 }    // namespace OpenXLSX
 
 // ========== XLRowIterator and XLRowReverseIterator ======================== //
@@ -385,13 +398,14 @@ namespace OpenXLSX
      * @post
      */
     XLRowIterator::XLRowIterator(const XLRowRange& rowRange, XLIteratorLocation loc)
-        : m_dataNode(std::make_unique<XMLNode>(*rowRange.m_dataNode)),
+        : m_dataNode(*rowRange.m_dataNode),
           m_firstRow(rowRange.m_firstRow),
           m_lastRow(rowRange.m_lastRow),
           m_currentRow(),
           m_sharedStrings(rowRange.m_sharedStrings),
+          m_sheetBounds(rowRange.m_sheetBounds),
           m_endReached(false),
-          m_hintRow(std::make_unique<XMLNode>()),
+          m_hintRow(),
           m_hintRowNumber(0),
           m_currentRowStatus(XLNotLoaded),
           m_currentRowNumber(0)
@@ -412,13 +426,14 @@ namespace OpenXLSX
      * @details copy constructor
      */
     XLRowIterator::XLRowIterator(const XLRowIterator& other)
-        : m_dataNode(std::make_unique<XMLNode>(*other.m_dataNode)),
+        : m_dataNode(other.m_dataNode),
           m_firstRow(other.m_firstRow),
           m_lastRow(other.m_lastRow),
           m_currentRow(other.m_currentRow),
           m_sharedStrings(other.m_sharedStrings),
+          m_sheetBounds(other.m_sheetBounds),
           m_endReached(other.m_endReached),
-          m_hintRow(std::make_unique<XMLNode>(*other.m_hintRow)),
+          m_hintRow(other.m_hintRow),
           m_hintRowNumber(other.m_hintRowNumber),
           m_currentRowStatus(other.m_currentRowStatus),
           m_currentRowNumber(other.m_currentRowNumber)
@@ -464,9 +479,9 @@ namespace OpenXLSX
 
         if (m_hintRow->empty()) {  // no hint has been established: fetch first row node the "tedious" way
             if (createIfMissing)     // getRowNode creates missing rows
-                m_currentRow = XLRow(getRowNode(*m_dataNode, m_currentRowNumber), m_sharedStrings.get());
+                m_currentRow = XLRow(getRowNode(*m_dataNode, m_currentRowNumber), m_sharedStrings.get(), m_sheetBounds);
             else                    // findRowNode returns an empty row for missing rows
-                m_currentRow = XLRow(findRowNode(*m_dataNode, m_currentRowNumber), m_sharedStrings.get());
+                m_currentRow = XLRow(findRowNode(*m_dataNode, m_currentRowNumber), m_sharedStrings.get(), m_sheetBounds);
         }
         else {
             // ===== Find or create, and fetch an XLRow at m_currentRowNumber
@@ -489,7 +504,7 @@ namespace OpenXLSX
                 if (rowNode.empty())    // if row could not be found / created
                     m_currentRow = XLRow{}; // make sure m_currentRow is set to an empty cell
                 else
-                    m_currentRow = XLRow(rowNode, m_sharedStrings.get());
+                    m_currentRow = XLRow(rowNode, m_sharedStrings.get(), m_sheetBounds);
             }
             else
                 throw XLInternalError("XLRowIterator::updateCurrentRow: an internal error occured (m_currentRowNumber <= m_hintRowNumber)");
@@ -498,8 +513,10 @@ namespace OpenXLSX
         if (m_currentRow.empty())   // if row is confirmed missing
             m_currentRowStatus = XLNoSuchRow;   // mark this status for further calls to updateCurrentRow()
         else {
+            if (createIfMissing && m_currentRow.m_rowNode->first_child().empty())    // the row may have been created
+                m_currentRow.markModified();
             // ===== If the current row exists, update the hints
-            m_hintRow          = std::make_unique<XMLNode>(*m_currentRow.m_rowNode);   // don't store a full XLRow, just the XMLNode, for better performance
+            m_hintRow          = m_currentRow.m_rowNode;    // don't store a full XLRow, just the XMLNode, for better performance
             m_hintRowNumber    = m_currentRowNumber;
             m_currentRowStatus = XLLoaded;                  // mark row status for further calls to updateCurrentRow()
         }
@@ -614,13 +631,14 @@ namespace OpenXLSX
      * @post
      */
     XLRowReverseIterator::XLRowReverseIterator(const XLRowRange& rowRange, XLIteratorLocation loc)
-        : m_dataNode(std::make_unique<XMLNode>(*rowRange.m_dataNode)),
+        : m_dataNode(*rowRange.m_dataNode),
           m_firstRow(rowRange.m_firstRow),
           m_lastRow(rowRange.m_lastRow),
           m_currentRow(),
           m_sharedStrings(rowRange.m_sharedStrings),
+          m_sheetBounds(rowRange.m_sheetBounds),
           m_endReached(false),
-          m_hintRow(std::make_unique<XMLNode>()),
+          m_hintRow(),
           m_hintRowNumber(0),
           m_currentRowStatus(XLNotLoaded),
           m_currentRowNumber(0)
@@ -641,13 +659,14 @@ namespace OpenXLSX
      * @details copy constructor
      */
     XLRowReverseIterator::XLRowReverseIterator(const XLRowReverseIterator& other)
-        : m_dataNode(std::make_unique<XMLNode>(*other.m_dataNode)),
+        : m_dataNode(other.m_dataNode),
           m_firstRow(other.m_firstRow),
           m_lastRow(other.m_lastRow),
           m_currentRow(other.m_currentRow),
           m_sharedStrings(other.m_sharedStrings),
+          m_sheetBounds(other.m_sheetBounds),
           m_endReached(other.m_endReached),
-          m_hintRow(std::make_unique<XMLNode>(*other.m_hintRow)),
+          m_hintRow(other.m_hintRow),
           m_hintRowNumber(other.m_hintRowNumber),
           m_currentRowStatus(other.m_currentRowStatus),
           m_currentRowNumber(other.m_currentRowNumber)
@@ -693,9 +712,9 @@ namespace OpenXLSX
 
         if (m_hintRow->empty()) {  // no hint has been established: fetch first row node the "tedious" way
             if (createIfMissing)     // getRowNode creates missing rows
-                m_currentRow = XLRow(getRowNode(*m_dataNode, m_currentRowNumber), m_sharedStrings.get());
+                m_currentRow = XLRow(getRowNode(*m_dataNode, m_currentRowNumber), m_sharedStrings.get(), m_sheetBounds);
             else                    // findRowNode returns an empty row for missing rows
-                m_currentRow = XLRow(findRowNode(*m_dataNode, m_currentRowNumber), m_sharedStrings.get());
+                m_currentRow = XLRow(findRowNode(*m_dataNode, m_currentRowNumber), m_sharedStrings.get(), m_sheetBounds);
         }
         else {
             // ===== Find or create, and fetch an XLRow at m_currentRowNumber
@@ -718,7 +737,7 @@ namespace OpenXLSX
                 if (rowNode.empty())    // if row could not be found / created
                     m_currentRow = XLRow{}; // make sure m_currentRow is set to an empty cell
                 else
-                    m_currentRow = XLRow(rowNode, m_sharedStrings.get());
+                    m_currentRow = XLRow(rowNode, m_sharedStrings.get(), m_sheetBounds);
             }
             else
                 throw XLInternalError("XLRowReverseIterator::updateCurrentRow: an internal error occured (m_currentRowNumber >= m_hintRowNumber)");
@@ -727,8 +746,10 @@ namespace OpenXLSX
         if (m_currentRow.empty())   // if row is confirmed missing
             m_currentRowStatus = XLNoSuchRow;   // mark this status for further calls to updateCurrentRow()
         else {
+            if (createIfMissing && m_currentRow.m_rowNode->first_child().empty())    // the row may have been created
+                m_currentRow.markModified();
             // ===== If the current row exists, update the hints
-            m_hintRow          = std::make_unique<XMLNode>(*m_currentRow.m_rowNode);   // don't store a full XLRow, just the XMLNode, for better performance
+            m_hintRow          = m_currentRow.m_rowNode;    // don't store a full XLRow, just the XMLNode, for better performance
             m_hintRowNumber    = m_currentRowNumber;
             m_currentRowStatus = XLLoaded;                  // mark row status for further calls to updateCurrentRow()
         }
@@ -845,21 +866,24 @@ namespace OpenXLSX
      * @pre
      * @post
      */
-    XLRowRange::XLRowRange(const XMLNode& dataNode, uint32_t first, uint32_t last, const XLSharedStrings& sharedStrings)
-        : m_dataNode(std::make_unique<XMLNode>(dataNode)),
+    XLRowRange::XLRowRange(const XMLNode& dataNode, uint32_t first, uint32_t last, const XLSharedStrings& sharedStrings,
+                           XLSheetBounds* sheetBounds)
+        : m_dataNode(dataNode),
           m_firstRow(first),
           m_lastRow(last),
-          m_sharedStrings(sharedStrings)
+          m_sharedStrings(sharedStrings),
+          m_sheetBounds(sheetBounds)
     {}
 
     /**
      * @details copy constructor
      */
     XLRowRange::XLRowRange(const XLRowRange& other)
-        : m_dataNode(std::make_unique<XMLNode>(*other.m_dataNode)),
+        : m_dataNode(other.m_dataNode),
           m_firstRow(other.m_firstRow),
           m_lastRow(other.m_lastRow),
-          m_sharedStrings(other.m_sharedStrings)
+          m_sharedStrings(other.m_sharedStrings),
+          m_sheetBounds(other.m_sheetBounds)
     {}
 
     /**
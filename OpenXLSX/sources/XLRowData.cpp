@@ -51,6 +51,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include "XLCell.hpp"
 #include "XLRow.hpp"
 #include "XLRowData.hpp"
+#include "XLSheetBounds.hpp"
 #include "XLXmlParser.hpp"
 #include "utilities/XLUtilities.hpp"
 
@@ -65,18 +66,26 @@ namespace OpenXLSX
      *       an XLIteratorLocation::End for such a range so that iterations can fail in a controlled manner
      */
     XLRowDataIterator::XLRowDataIterator(const XLRowDataRange& rowDataRange, XLIteratorLocation loc)
-        : m_dataRange(std::make_unique<XLRowDataRange>(rowDataRange)),
-          m_cellNode(std::make_unique<XMLNode>(
-              getCellNode((m_dataRange->size() ? *m_dataRange->m_rowNode : XMLNode {}), m_dataRange->m_firstCol))),
-          m_currentCell(loc == XLIteratorLocation::End ? XLCell() : XLCell(*m_cellNode, m_dataRange->m_sharedStrings.get()))
-    {}
+        : m_rowNode(*rowDataRange.m_rowNode),
+          m_lastCol(rowDataRange.m_lastCol),
+          m_sharedStrings(rowDataRange.m_sharedStrings),
+          m_sheetBounds(rowDataRange.m_sheetBounds),
+          m_currentCell(loc == XLIteratorLocation::End
+                            ? XLCell()
+                            : XLCell(getCellNode((rowDataRange.size() ? *m_rowNode : XMLNode {}), rowDataRange.m_firstCol), m_sharedStrings.get(),
+                                     m_sheetBounds))
+    {
+        if (m_sheetBounds != nullptr && m_currentCell) m_sheetBounds->extend(rowDataRange.m_firstCol, *m_currentCell.m_cellNode);
+    }
 
     /**
-     * @details Copy constructor. Trivial implementation with deep copy of pointer members.
+     * @details Copy constructor. Trivial implementation, the iterator holds no pointer members.
      */
     XLRowDataIterator::XLRowDataIterator(const XLRowDataIterator& other)
-        : m_dataRange(std::make_unique<XLRowDataRange>(*other.m_dataRange)),
-          m_cellNode(std::make_unique<XMLNode>(*other.m_cellNode)),
+        : m_rowNode(other.m_rowNode),
+          m_lastCol(other.m_lastCol),
+          m_sharedStrings(other.m_sharedStrings),
+          m_sheetBounds(other.m_sheetBounds),
           m_currentCell(other.m_currentCell)
     {}
 
@@ -118,30 +127,31 @@ namespace OpenXLSX
             throw XLInputError("XLRowDataIterator: tried to increment beyond end operator");
 
         // ===== Compute the column number, and move the m_cellNode to the next sibling.
-        const uint16_t cellNumber = m_currentCell.cellReference().column() + 1;
+        const uint16_t cellNumber = getCellColumn(*m_currentCell.m_cellNode) + 1;
         XMLNode        cellNode   = m_currentCell.m_cellNode->next_sibling_of_type(pugi::node_element);
 
         // ===== If the cellNumber exceeds the last column in the range,
         // ===== m_currentCell is set to an empty XLCell, indicating the end of the range has been reached.
-        if (cellNumber > m_dataRange->m_lastCol) m_currentCell = XLCell();
+        if (cellNumber > m_lastCol) m_currentCell = XLCell();
 
         // ====== If the cellNode is empty (i.e. no more children in the current row node) or the column number of the cell node
         // ====== is higher than the computed column number, then insert the node.
         // BUG BUGFIX 2024-04-26: check was for m_cellNode->empty(), allowing an invalid test for the attribute r, discovered
         //       because the modified XLCellReference throws an exception on invalid parameter
-        else if (cellNode.empty() || XLCellReference(cellNode.attribute("r").value()).column() > cellNumber) {
-            cellNode = m_dataRange->m_rowNode->insert_child_after("c", *m_currentCell.m_cellNode);
+        else if (cellNode.empty() || getCellColumn(cellNode) > cellNumber) {
+            cellNode = m_rowNode->insert_child_after("c", *m_currentCell.m_cellNode);
             setDefaultCellAttributes(cellNode, XLCellReference(
-            /**/                                   static_cast<uint32_t>(m_dataRange->m_rowNode->attribute("r").as_ullong()), cellNumber
+            /**/                                   static_cast<uint32_t>(m_rowNode->attribute("r").as_ullong()), cellNumber
             /**/                               ).address(),
-            /**/                               *m_dataRange->m_rowNode, cellNumber);
-            m_currentCell = XLCell(cellNode, m_dataRange->m_sharedStrings.get());
+            /**/                               *m_rowNode, cellNumber);
+            m_currentCell = XLCell(cellNode, m_sharedStrings.get(), m_sheetBounds);
+            if (m_sheetBounds != nullptr) m_sheetBounds->extend(cellNumber);
         }
 
         // ===== Otherwise, the cell node and the column number match.
         else {
-            assert(XLCellReference(cellNode.attribute("r").value()).column() == cellNumber);
-            m_currentCell = XLCell(cellNode, m_dataRange->m_sharedStrings.get());
+            assert(getCellColumn(cellNode) == cellNumber);
+            m_currentCell = XLCell(cellNode, m_sharedStrings.get(), m_sheetBounds);
         }
 
         return *this;
@@ -204,7 +214,7 @@ namespace OpenXLSX
      * exception.
      */
     XLRowDataRange::XLRowDataRange()
-        : m_rowNode(nullptr),
+        : m_rowNode(),
           m_firstCol(1),    // first col of 1
           m_lastCol(0),     // and last col of 0 will ensure that size returns 0
           m_sharedStrings(XLSharedStringsDefaulted)
@@ -215,11 +225,16 @@ namespace OpenXLSX
     /**
      * @details [private] constructor. Trivial implementation.
      */
-    XLRowDataRange::XLRowDataRange(const XMLNode& rowNode, uint16_t firstColumn, uint16_t lastColumn, const XLSharedStrings& sharedStrings)
-        : m_rowNode(std::make_unique<XMLNode>(rowNode)),
+    XLRowDataRange::XLRowDataRange(const XMLNode&         rowNode,
+                                   uint16_t               firstColumn,
+                                   uint16_t               lastColumn,
+                                   const XLSharedStrings& sharedStrings,
+                                   XLSheetBounds*         sheetBounds)
+        : m_rowNode(rowNode),
           m_firstCol(firstColumn),
           m_lastCol(lastColumn),
-          m_sharedStrings(sharedStrings)
+          m_sharedStrings(sharedStrings),
+          m_sheetBounds(sheetBounds)
     {
         if (lastColumn < firstColumn) {
             m_firstCol = 1;
@@ -232,10 +247,11 @@ namespace OpenXLSX
      * @details copy constructor. Trivial implementation.
      */
     XLRowDataRange::XLRowDataRange(const XLRowDataRange& other)
-        : m_rowNode((other.m_rowNode != nullptr) ? std::make_unique<XMLNode>(*other.m_rowNode) : nullptr),    // 2024-05-28: support for copy-construction from an empty XLDataRange
+        : m_rowNode(other.m_rowNode),    // an empty XLDataRange holds an empty XMLNode
           m_firstCol(other.m_firstCol),
           m_lastCol(other.m_lastCol),
-          m_sharedStrings(other.m_sharedStrings)
+          m_sharedStrings(other.m_sharedStrings),
+          m_sheetBounds(other.m_sheetBounds)
     {}
 
     /**
@@ -358,6 +374,7 @@ namespace OpenXLSX
             XLCell(curNode, m_row->m_sharedStrings.get()).value() = *value;
             --colNo;
         }
+        if (m_row->m_sheetBounds != nullptr) m_row->m_sheetBounds->extend(static_cast<uint16_t>(values.size()));
 
         return *this;
     }
@@ -375,7 +392,7 @@ namespace OpenXLSX
         if (values.size() > MAX_COLS) throw XLOverflowError("vector<bool> size exceeds maximum number of columns.");
         if (values.empty()) return *this;
 
-        auto range = XLRowDataRange(*m_rowNode, 1, static_cast<uint16_t>(values.size()), m_row->m_sharedStrings.get());
+        auto range = XLRowDataRange(*m_rowNode, 1, static_cast<uint16_t>(values.size()), m_row->m_sharedStrings.get(), m_row->m_sheetBounds);
         auto dst   = range.begin();    // 2024-04-30: whitespace support: safe because XLRowDataRange::begin invokes whitespace-safe
                                        // getCellNode for column 1
         auto src = values.begin();
@@ -420,7 +437,7 @@ namespace OpenXLSX
     {
         // ===== Determine the number of cells in the current row. Create a std::vector of the same size.
         const XMLNode  lastElementChild = m_rowNode->last_child_of_type(pugi::node_element);
-        const uint16_t numCells = (lastElementChild.empty() ? 0 : XLCellReference(lastElementChild.attribute("r").value()).column());
+        const uint16_t numCells = (lastElementChild.empty() ? 0 : getCellColumn(lastElementChild));
         std::vector<XLCellValue> result(static_cast<uint64_t>(numCells));
 
         // ===== If there are one or more cells in the current row, iterate through them and add the value to the container.
@@ -428,7 +445,7 @@ namespace OpenXLSX
             XMLNode node = lastElementChild;    // avoid unneeded call to first_child_of_type by iterating backwards, vector is random
                                                 // access so it doesn't matter
             while (not node.empty()) {
-                result[XLCellReference(node.attribute("r").value()).column() - 1] = XLCell(node, m_row->m_sharedStrings.get()).value();
+                result[getCellColumn(node) - 1] = XLCell(node, m_row->m_sharedStrings.get()).value();
                 node                                                              = node.previous_sibling_of_type(pugi::node_element);
             }
         }
@@ -445,6 +462,13 @@ namespace OpenXLSX
      */
     const XLSharedStrings& XLRowDataProxy::getSharedStrings() const { return m_row->m_sharedStrings.get(); }
 
+    /**
+     * @details The function returns the XLSheetBounds pointer embedded in the m_row member, for the same reason as getSharedStrings.
+     * @pre
+     * @post
+     */
+    XLSheetBounds* XLRowDataProxy::getSheetBounds() const { return m_row->m_sheetBounds; }
+
     /**
      * @details The deleteCellValues is a convenience function used solely by the templated operator= function.
      * The purpose of a separate function is to keep details of xml_node out of the header file.
@@ -453,11 +477,13 @@ namespace OpenXLSX
      */
     void XLRowDataProxy::deleteCellValues(uint16_t count)    // NOLINT   // 2024-04-30: whitespace support
     {
+        m_row->markModified();
+
         // ===== Mark cell nodes for deletion
         std::vector<XMLNode> toBeDeleted;
         XMLNode              cellNode = m_rowNode->first_child_of_type(pugi::node_element);
         while (not cellNode.empty()) {
-            if (XLCellReference(cellNode.attribute("r").value()).column() <= count) {
+            if (getCellColumn(cellNode) <= count) {
                 toBeDeleted.emplace_back(cellNode);
                 XMLNode nextNode = cellNode.next_sibling();    // get next "regular" sibling (any type) before advancing cellNode
                 cellNode         = cellNode.next_sibling_of_type(pugi::node_element);
@@ -496,6 +522,7 @@ namespace OpenXLSX
         XMLNode curNode = m_rowNode->prepend_child("c");    // this will correctly insert a new cell directly at the beginning of the row
         setDefaultCellAttributes(curNode, XLCellReference(static_cast<uint32_t>(m_row->rowNumber()), col).address(), *m_rowNode, col);
         XLCell(curNode, m_row->m_sharedStrings.get()).value() = value;
+        if (m_row->m_sheetBounds != nullptr) m_row->m_sheetBounds->extend(col);
     }
 
     /**
@@ -503,6 +530,11 @@ namespace OpenXLSX
      * @pre
      * @post
      */
-    void XLRowDataProxy::clear() { m_rowNode->remove_children(); }    // NOLINT
+    void XLRowDataProxy::clear()    // NOLINT
+    {
+        const XMLNode lastCell = m_rowNode->last_child_of_type(pugi::node_element);
+        if (m_row->m_sheetBounds != nullptr && not lastCell.empty()) m_row->m_sheetBounds->shrink(getCellColumn(lastCell));
+        m_rowNode->remove_children();
+    }
 
 }    // namespace OpenXLSX
@@ -0,0 +1,206 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+// ===== External Includes ===== //
+#include <iterator>    // std::prev
+#include <string>
+
+// ===== OpenXLSX Includes ===== //
+#include "XLConstants.hpp"
+#include "XLException.hpp"
+#include "XLRowIndex.hpp"
+
+using namespace OpenXLSX;
+
+namespace
+{
+    /**
+     * @brief throw XLCellAddressError if rowNumber is outside the valid range, like findRowNode and getRowNode
+     */
+    void checkRowNumber(uint32_t rowNumber)
+    {
+        if (rowNumber < 1 || rowNumber > OpenXLSX::MAX_ROWS) {
+            using namespace std::literals::string_literals;
+            throw XLCellAddressError("rowNumber "s + std::to_string(rowNumber) + " is outside valid range [1;"s + std::to_string(OpenXLSX::MAX_ROWS) + "]"s);
+        }
+    }
+
+    /**
+     * @brief get the row number of a row node, 0 if the node has no valid r attribute
+     */
+    uint32_t rowNumberOf(const pugi::xml_node& rowNode) { return static_cast<uint32_t>(rowNode.attribute("r").as_ullong()); }
+}    // namespace
+
+/**
+ * @details
+ */
+XMLNode XLRowIndex::findRow(XMLNode sheetDataNode, uint32_t rowNumber)
+{
+    checkRowNumber(rowNumber);
+    const XMLNode rowNode = locate(sheetDataNode, rowNumber);
+    if (rowNode.empty() || rowNumberOf(rowNode) != rowNumber) return XMLNode {};
+    return rowNode;
+}
+
+/**
+ * @details
+ */
+XMLNode XLRowIndex::lowerBound(XMLNode sheetDataNode, uint32_t rowNumber)
+{
+    checkRowNumber(rowNumber);
+    const XMLNode rowNode = locate(sheetDataNode, rowNumber);
+    if (rowNode.empty()) return sheetDataNode.first_child_of_type(pugi::node_element);
+    if (rowNumberOf(rowNode) < rowNumber) return rowNode.next_sibling_of_type(pugi::node_element);
+    return rowNode;
+}
+
+/**
+ * @details A new row node is inserted after the row located by locate, so that the rows stay in ascending order. As in getRowNode,
+ *  a row preceding all other rows is prepended, and a row following all other rows is appended to sheetData.
+ */
+XMLNode XLRowIndex::getRow(XMLNode sheetDataNode, uint32_t rowNumber)
+{
+    checkRowNumber(rowNumber);
+    XMLNode rowNode = locate(sheetDataNode, rowNumber);
+    if (not rowNode.empty() && rowNumberOf(rowNode) == rowNumber) return rowNode;
+
+    if (rowNode.empty())
+        rowNode = sheetDataNode.first_child_of_type(pugi::node_element).empty() ? sheetDataNode.append_child("row") : sheetDataNode.prepend_child("row");
+    else if (rowNode == sheetDataNode.last_child_of_type(pugi::node_element))
+        rowNode = sheetDataNode.append_child("row");
+    else
+        rowNode = sheetDataNode.insert_child_after("row", rowNode);
+    rowNode.append_attribute("r") = rowNumber;
+
+    insert(rowNumber, rowNode);
+    return rowNode;
+}
+
+/**
+ * @details
+ */
+bool XLRowIndex::deleteRow(XMLNode sheetDataNode, uint32_t rowNumber)
+{
+    if (rowNumber < 1 || rowNumber > OpenXLSX::MAX_ROWS) return false;
+    const XMLNode rowNode = locate(sheetDataNode, rowNumber);
+    if (rowNode.empty() || rowNumberOf(rowNode) != rowNumber) return false;
+
+    m_rows.erase(rowNumber);
+    return sheetDataNode.remove_child(rowNode);
+}
+
+/**
+ * @details
+ */
+void XLRowIndex::clear()
+{
+    m_sheetDataNode = pugi::xml_node {};
+    m_rows.clear();
+}
+
+/**
+ * @details The sheetData node changes when the XML document is reloaded, in which case all indexed nodes are invalid.
+ */
+void XLRowIndex::update(XMLNode sheetDataNode)
+{
+    if (m_sheetDataNode == sheetDataNode) return;
+
+    m_rows.clear();
+    m_sheetDataNode = sheetDataNode;
+    XMLNode rowNode = sheetDataNode.first_child_of_type(pugi::node_element);
+    while (not rowNode.empty()) {
+        insert(rowNumberOf(rowNode), rowNode);
+        rowNode = rowNode.next_sibling_of_type(pugi::node_element);
+    }
+}
+
+/**
+ * @details Rows without a valid row number are not indexed.
+ */
+void XLRowIndex::insert(uint32_t rowNumber, const pugi::xml_node& rowNode)
+{
+    if (rowNumber < 1 || rowNumber > OpenXLSX::MAX_ROWS) return;
+    m_rows.insert_or_assign(rowNumber, rowNode);
+}
+
+/**
+ * @details On an index hit, the row node is returned directly. Otherwise, the nearest indexed rows before and after rowNumber are
+ *  taken from the ordered index, and the XML is searched from there: forwards from the row before, or backwards from the row
+ *  after (or from the last row) if there is no indexed row before rowNumber. Any row that is not indexed yet is added to the
+ *  index on the way.
+ */
+XMLNode XLRowIndex::locate(XMLNode sheetDataNode, uint32_t rowNumber)
+{
+    update(sheetDataNode);
+
+    // ===== Find the indexed row, or the nearest indexed rows before and after rowNumber
+    auto it = m_rows.lower_bound(rowNumber);
+    if (it != m_rows.end() && it->first == rowNumber) return it->second;
+    const pugi::xml_node after  = it == m_rows.end() ? pugi::xml_node {} : it->second;
+    const pugi::xml_node before = it == m_rows.begin() ? pugi::xml_node {} : std::prev(it)->second;
+
+    XMLNode result {};
+    if (not before.empty()) {
+        // ===== Search forwards, over rows that may have been added without the index
+        result       = before;
+        XMLNode next = result.next_sibling_of_type(pugi::node_element);
+        while (not next.empty() && rowNumberOf(next) <= rowNumber) {
+            result = next;
+            insert(rowNumberOf(result), result);
+            next = result.next_sibling_of_type(pugi::node_element);
+        }
+    }
+    else {
+        // ===== Search backwards, over rows that may have been added without the index
+        result = after.empty() ? sheetDataNode.last_child_of_type(pugi::node_element) : XMLNode(after).previous_sibling_of_type(pugi::node_element);
+        while (not result.empty() && rowNumberOf(result) > rowNumber) {
+            insert(rowNumberOf(result), result);
+            result = result.previous_sibling_of_type(pugi::node_element);
+        }
+        if (not result.empty()) insert(rowNumberOf(result), result);
+    }
+
+    return result;
+}
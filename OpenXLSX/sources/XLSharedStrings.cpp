@@ -44,9 +44,11 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
  */
 
 // ===== External Includes ===== //
-#include <algorithm>
+#include <string>
+#include <utility>    // std::move
 
 // ===== OpenXLSX Includes ===== //
+#include "IZipArchive.hpp"    // XLZipEntryWriter
 #include "XLDocument.hpp"
 #include "XLSharedStrings.hpp"
 #include "XLXmlParser.hpp"              // pugixml wrapper
@@ -57,6 +59,40 @@ namespace OpenXLSX {
     const XLSharedStrings XLSharedStringsDefaulted{};
 }    // namespace OpenXLSX
 
+namespace
+{
+    constexpr size_t XLSharedStringsFlushSize = 65536; /**< serialized XML is passed on to the archive entry in chunks of about this size */
+
+    /**
+     * @brief append text to an XML string, escaping it like pugixml escapes character data
+     */
+    void appendEscaped(std::string& out, std::string_view text)
+    {
+        for (const char c : text) {
+            switch (c) {
+                case '&':
+                    out += "&amp;";
+                    break;
+                case '<':
+                    out += "&lt;";
+                    break;
+                case '>':
+                    out += "&gt;";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 32 && c != '\t' && c != '\n' && c != '\r') {
+                        out += "&#";
+                        out += std::to_string(static_cast<int>(c));
+                        out += ';';
+                    }
+                    else
+                        out += c;
+                    break;
+            }
+        }
+    }
+}    // namespace
+
 using namespace OpenXLSX;
 
 /**
@@ -69,24 +105,15 @@ XLSharedStrings::XLSharedStrings() = default;
  * @details Constructs a new XLSharedStrings object. Only one (common) object is allowed per XLDocument instance.
  * A filepath to the underlying XML file must be provided.
  */
-XLSharedStrings::XLSharedStrings(XLXmlData* xmlData, std::deque<std::string>* stringCache)
+XLSharedStrings::XLSharedStrings(XLXmlData*               xmlData,
+                                 XLStringArena*           stringCache,
+                                 XLSharedStringIndex*     stringIndex,
+                                 XLSharedStringRefCounts* refCounts)
     : XLXmlFile(xmlData),
-      m_stringCache(stringCache)
-{
-    XMLDocument & doc = xmlDocument();
-    if (doc.document_element().empty())    // handle a bad (no document element) xl/sharedStrings.xml
-        doc.load_string(
-                "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
-                "<sst xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\">\n"    // pull request #192 -> remove count &
-                                                                                                 // uniqueCount as they are optional
-                // 2024-09-03: removed empty string entry on creation, as it appears to just waste a string index that will never be used
-                // "  <si>\n"
-                // "    <t/>\n"
-                // "  </si>\n"
-                "</sst>",
-                pugi_parse_settings
-        );
-}
+      m_stringCache(stringCache),
+      m_stringIndex(stringIndex),
+      m_refCounts(refCounts)
+{}
 
 
 /**
@@ -119,9 +146,16 @@ XLSharedStrings& XLSharedStrings::operator=(XLSharedStrings&& other) noexcept =
  */
 int32_t XLSharedStrings::getStringIndex(const std::string& str) const
 {
-    const auto iter = std::find_if(m_stringCache->begin(), m_stringCache->end(), [&](const std::string& s) { return str == s; });
+    if (m_stringIndex != nullptr) {
+        ensureStringIndex();
+        const auto indexIter = m_stringIndex->find(std::string_view(str));
+        return indexIter == m_stringIndex->end() ? -1 : indexIter->second;
+    }
+
+    for (size_t index = 0; index < m_stringCache->size(); ++index)
+        if (m_stringCache->view(index) == str) return static_cast<int32_t>(index);
 
-    return iter == m_stringCache->end() ? -1 : static_cast<int32_t>(std::distance(m_stringCache->begin(), iter));
+    return -1;
 }
 
 /**
@@ -138,7 +172,7 @@ const char* XLSharedStrings::getString(int32_t index) const
         using namespace std::literals::string_literals;
         throw XLInternalError("XLSharedStrings::"s + __func__ + ": index "s + std::to_string(index) + " is out of range"s);
     }
-    return (*m_stringCache)[index].c_str();
+    return m_stringCache->c_str(static_cast<size_t>(index));    // decodes the string on first access
 }
 
 /**
@@ -147,21 +181,64 @@ const char* XLSharedStrings::getString(int32_t index) const
  */
 int32_t XLSharedStrings::appendString(const std::string& str) const
 {
+    rejectIfReadOnly(__func__);
     // size_t stringCacheSize = std::distance(m_stringCache->begin(), m_stringCache->end()); // any reason why .size() would not work?
     size_t stringCacheSize = m_stringCache->size();    // 2024-05-31: analogous with already added range check in getString
     if (stringCacheSize >= XLMaxSharedStrings)    {    // 2024-05-31: added range check
         using namespace std::literals::string_literals;
         throw XLInternalError("XLSharedStrings::"s + __func__ + ": exceeded max strings count "s + std::to_string(XLMaxSharedStrings));
     }
-    auto textNode = xmlDocument().document_element().append_child("si").append_child("t");
-    if ((!str.empty()) && (str.front() == ' ' || str.back() == ' '))
-        textNode.append_attribute("xml:space").set_value("preserve");    // pull request #161
-    textNode.text().set(str.c_str());
-    m_stringCache->emplace_back(textNode.text().get());    // index of this element = previous stringCacheSize
+    ensureStringIndex();
+    if (not deferXmlUpdate()) {
+        auto textNode = sstNode().append_child("si").append_child("t");
+        if ((!str.empty()) && (str.front() == ' ' || str.back() == ' '))
+            textNode.append_attribute("xml:space").set_value("preserve");    // pull request #161
+        textNode.text().set(str.c_str());
+    }
+    m_stringCache->append(str);    // index of this element = previous stringCacheSize
+    if (m_refCounts != nullptr) m_refCounts->push_back(0);    // the caller is expected to retain the string for its cell
+    if (m_stringIndex != nullptr)    // key must view the cached copy, not str - try_emplace keeps the lowest index for a duplicate
+        m_stringIndex->try_emplace(m_stringCache->view(stringCacheSize), static_cast<int32_t>(stringCacheSize));
 
     return static_cast<int32_t>(stringCacheSize);
 }
 
+/**
+ * @details Single hash lookup for the common case of an existing string, falls back to appendString otherwise
+ */
+int32_t XLSharedStrings::getOrAppendString(const std::string& str) const
+{
+    const int32_t index = getStringIndex(str);
+    return index >= 0 ? index : appendString(str);
+}
+
+/**
+ * @details With the Adaptive mode, a string that is in the table already is always reused, only new strings are stored inline
+ */
+int32_t XLSharedStrings::getOrAppendStringByPolicy(const std::string& str) const
+{
+    const XLStringWritePolicy& policy = parentDoc().m_stringWritePolicy;
+    switch (policy.mode) {
+        case XLStringWriteMode::InlineStrings:
+            return -1;
+        case XLStringWriteMode::Adaptive:
+            if (const int32_t index = getStringIndex(str); index >= 0) return index;
+            if (str.length() >= policy.inlineMinLength || static_cast<size_t>(stringCount()) >= policy.maxSharedStrings) return -1;
+            return appendString(str);
+        default:
+            return getOrAppendString(str);
+    }
+}
+
+/**
+ * @details
+ */
+uint32_t XLSharedStrings::referenceCount(int32_t index) const
+{
+    if (m_refCounts == nullptr || index < 0 || static_cast<size_t>(index) >= m_refCounts->size()) return XLUnknownReferenceCount;
+    return (*m_refCounts)[index];
+}
+
 /**
  * @details Print the underlying XML using pugixml::xml_node::print
  */
@@ -174,12 +251,30 @@ void XLSharedStrings::print(std::basic_ostream<char>& ostr) const { xmlDocument(
  */
 void XLSharedStrings::clearString(int32_t index) const   // 2024-04-30: whitespace support
 {
+    rejectIfReadOnly(__func__);
     if (index < 0 || static_cast<size_t>(index) >= m_stringCache->size()) { // 2024-04-30: added range check
         using namespace std::literals::string_literals;
         throw XLInternalError("XLSharedStrings::"s + __func__ + ": index "s + std::to_string(index) + " is out of range"s);
     }
 
-    (*m_stringCache)[index] = "";
+    ensureStringIndex();
+    const std::string_view clearedString = m_stringCache->view(static_cast<size_t>(index));    // stays valid, see XLStringArena::assign
+    m_stringCache->assign(static_cast<size_t>(index), "");
+    if (m_stringIndex != nullptr) {
+        // ===== If the index entry of the cleared string points to index, re-point it to a remaining duplicate, or remove it
+        const auto indexIter = m_stringIndex->find(clearedString);
+        if (indexIter != m_stringIndex->end() && indexIter->second == index) {
+            int32_t duplicateIndex = -1;
+            for (size_t i = 0; i < m_stringCache->size() && duplicateIndex < 0; ++i)
+                if (m_stringCache->view(i) == clearedString) duplicateIndex = static_cast<int32_t>(i);    // index itself is "" now
+            if (duplicateIndex >= 0)
+                indexIter->second = duplicateIndex;
+            else
+                m_stringIndex->erase(indexIter);
+        }
+        m_stringIndex->try_emplace(m_stringCache->view(static_cast<size_t>(index)), index);
+    }
+    if (deferXmlUpdate()) return;
     // auto iter            = xmlDocument().document_element().children().begin();
     // std::advance(iter, index);
     // iter->text().set(""); // 2024-04-30: BUGFIX: this was never going to work, <si> entries can be plenty that need to be cleared,
@@ -190,7 +285,7 @@ void XLSharedStrings::clearString(int32_t index) const   // 2024-04-30: whitespa
      * Potential solution: store the XML child position with each entry in m_stringCache in a std::deque<struct entry>
      *   with struct entry { std::string s; uint64_t xmlChildIndex; };
      */
-    XMLNode  sharedStringNode = xmlDocument().document_element().first_child_of_type(pugi::node_element);
+    XMLNode  sharedStringNode = sstNode().first_child_of_type(pugi::node_element);
     int32_t sharedStringPos  = 0;
     while (sharedStringPos < index && not sharedStringNode.empty()) {
         sharedStringNode = sharedStringNode.next_sibling_of_type(pugi::node_element);
@@ -207,14 +302,191 @@ void XLSharedStrings::clearString(int32_t index) const   // 2024-04-30: whitespa
  */
 int32_t XLSharedStrings::rewriteXmlFromCache()
 {
+    if (deferXmlUpdate()) {
+        rebuildStringIndex();
+        return static_cast<int32_t>(m_stringCache->size());
+    }
+
     int32_t writtenStrings = 0;
-    xmlDocument().document_element().remove_children();  // clear all existing XML
-    for (std::string& s : *m_stringCache) {
-        XMLNode textNode = xmlDocument().document_element().append_child("si").append_child("t");
+    XMLNode sst            = sstNode();
+    sst.remove_children();  // clear all existing XML
+    for (size_t index = 0; index < m_stringCache->size(); ++index) {
+        const std::string_view s        = m_stringCache->view(index);
+        XMLNode                textNode = sst.append_child("si").append_child("t");
         if ((!s.empty()) && (s.front() == ' ' || s.back() == ' '))
             textNode.append_attribute("xml:space").set_value("preserve");    // preserve spaces at begin/end of string
-        textNode.text().set(s.c_str());
+        textNode.text().set(s.data());    // XLStringArena strings are zero-terminated
         ++writtenStrings;
     }
+    rebuildStringIndex();
     return writtenStrings;
 }
+
+/**
+ * @details Writes the same XML as rewriteXmlFromCache would generate, in chunks of about XLSharedStringsFlushSize
+ */
+int32_t XLSharedStrings::writeXmlFromCache(XLZipEntryWriter& entry, const XLXmlSavingDeclaration& savingDeclaration) const
+{
+    std::string buffer {};
+    buffer.reserve(XLSharedStringsFlushSize + 4096);
+    buffer += "<?xml version=\"" + savingDeclaration.version() + "\" encoding=\"" + savingDeclaration.encoding() + "\"";
+    if (savingDeclaration.standalone_as_bool()) buffer += " standalone=\"yes\"";
+    buffer += "?>\n<sst xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\">";    // pull request #192: no count & uniqueCount
+
+    int32_t writtenStrings = 0;
+    for (size_t index = 0; index < m_stringCache->size(); ++index) {
+        const std::string_view s = m_stringCache->view(index);
+        buffer += ((!s.empty()) && (s.front() == ' ' || s.back() == ' ')) ? "<si><t xml:space=\"preserve\">" : "<si><t>";
+        appendEscaped(buffer, s);
+        buffer += "</t></si>";
+        ++writtenStrings;
+        if (buffer.size() >= XLSharedStringsFlushSize) {
+            entry.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+    buffer += "</sst>";
+    entry.write(buffer.data(), buffer.size());
+    return writtenStrings;
+}
+
+/**
+ * @details An unknown count stays unknown, a count that would overflow becomes unknown
+ */
+void XLSharedStrings::retainString(int32_t index) const
+{
+    if (m_refCounts == nullptr || index < 0 || static_cast<size_t>(index) >= m_refCounts->size()) return;
+    uint32_t& count = (*m_refCounts)[index];
+    if (count != XLUnknownReferenceCount) ++count;
+}
+
+/**
+ * @details A string read from the file has an unknown reference count, so releasing one of its references can not be counted.
+ *  Instead, the document is flagged to count the references of all strings before the unused strings are released on save.
+ */
+void XLSharedStrings::releaseString(int32_t index) const
+{
+    if (m_refCounts == nullptr || index < 0 || static_cast<size_t>(index) >= m_refCounts->size()) return;
+    uint32_t& count = (*m_refCounts)[index];
+    if (count == XLUnknownReferenceCount)
+        parentDoc().m_sharedStringReferencesUncounted = true;    // the string may be unused now: count the references on save
+    else if (count > 0)
+        --count;
+}
+
+/**
+ * @details
+ */
+void XLSharedStrings::forgetReferenceCounts() const
+{
+    if (m_refCounts != nullptr) m_refCounts->assign(m_refCounts->size(), XLUnknownReferenceCount);
+}
+
+/**
+ * @details The cache is rebuilt from the strings that are still referenced, which returns the memory of the released strings.
+ *  As the content of a released string is empty, a later lookup of an empty string may return its index, which is harmless.
+ *  In the XML, only the <si> nodes of the released strings are modified, so that the formatting (rich text and phonetic runs)
+ *  of the other strings is kept.
+ */
+int32_t XLSharedStrings::releaseUnusedStrings()
+{
+    if (m_refCounts == nullptr) return 0;
+
+    // ===== Find the released strings - nothing to do if all strings are referenced, or are empty already
+    int32_t releasedStrings = 0;
+    size_t  newStringCount  = 0;    // unreferenced strings at the end of the table are removed
+    for (size_t index = 0; index < m_refCounts->size(); ++index) {
+        if ((*m_refCounts)[index] != 0) newStringCount = index + 1;
+        else if (not m_stringCache->view(index).empty()) ++releasedStrings;
+    }
+    if (releasedStrings == 0 && newStringCount == m_refCounts->size()) return 0;
+
+    XLStringArena newStringCache {};
+    for (size_t index = 0; index < newStringCount; ++index)
+        newStringCache.append((*m_refCounts)[index] == 0 ? std::string_view() : m_stringCache->view(index));
+
+    if (m_stringIndex != nullptr) m_stringIndex->clear();    // index keys view the old cache
+    *m_stringCache = std::move(newStringCache);
+    m_refCounts->resize(newStringCount);
+    rebuildStringIndex();
+
+    // ===== Clear the released <si> nodes like clearString, and remove those at the end of the table
+    if (not deferXmlUpdate()) {
+        XMLNode sst              = sstNode();
+        XMLNode sharedStringNode = sst.first_child_of_type(pugi::node_element);
+        for (size_t index = 0; not sharedStringNode.empty(); ++index) {
+            const XMLNode next = sharedStringNode.next_sibling_of_type(pugi::node_element);
+            if (index >= newStringCount)
+                sst.remove_child(sharedStringNode);
+            else if ((*m_refCounts)[index] == 0) {
+                sharedStringNode.remove_children();    // clear all data and formatting
+                sharedStringNode.append_child("t");    // append an empty text node
+            }
+            sharedStringNode = next;
+        }
+    }
+    return releasedStrings;
+}
+
+/**
+ * @details
+ */
+void XLSharedStrings::rebuildStringIndex() const
+{
+    if (m_stringIndex == nullptr || m_stringCache == nullptr) return;
+
+    m_stringIndex->clear();
+    m_stringIndex->reserve(m_stringCache->size());
+    for (size_t index = 0; index < m_stringCache->size(); ++index)
+        m_stringIndex->try_emplace(m_stringCache->view(index), static_cast<int32_t>(index));    // on duplicate strings, keep the first index
+}
+
+/**
+ * @details The index is empty until built, as each string index has an entry once it is built
+ */
+void XLSharedStrings::ensureStringIndex() const
+{
+    if (m_stringIndex != nullptr && m_stringIndex->empty() && not m_stringCache->empty()) rebuildStringIndex();
+}
+
+/**
+ * @details
+ */
+bool XLSharedStrings::deferXmlUpdate() const
+{
+    const XLDocument& doc   = parentDoc();
+    const bool        defer = doc.deferredSharedStrings();    // not for formatted strings, which the cache does not hold
+    if (defer) doc.m_sharedStringsXmlOutdated = true;
+    return defer;
+}
+
+/**
+ * @details The shared strings of a read-only document are shared by all its worksheets and can not be saved: a modification
+ *  would only corrupt the values read from other cells.
+ */
+void XLSharedStrings::rejectIfReadOnly(const char* function) const
+{
+    using namespace std::literals::string_literals;
+    if (parentDoc().isReadOnly())
+        throw XLException("XLSharedStrings::"s + function + ": the document was opened read-only"s);
+}
+
+/**
+ * @details The count & uniqueCount attributes are removed once the shared strings get modified, as they would no longer match
+ */
+XMLNode XLSharedStrings::sstNode() const
+{
+    XMLDocument& doc = const_cast<XMLDocument&>(xmlDocument());
+    if (doc.document_element().empty())    // handle a bad (no document element) xl/sharedStrings.xml
+        doc.load_string(
+                "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                "<sst xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\">\n"
+                // 2024-09-03: removed empty string entry on creation, as it appears to just waste a string index that will never be used
+                "</sst>",
+                pugi_parse_settings
+        );
+    XMLNode sst = doc.document_element();
+    sst.remove_attribute("uniqueCount");    // pull request #192 -> remove count & uniqueCount as they are optional
+    sst.remove_attribute("count");
+    return sst;
+}
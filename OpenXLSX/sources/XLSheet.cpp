@@ -44,16 +44,21 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
  */
 
 // ===== External Includes ===== //
-#include <algorithm> // std::max
+#include <algorithm> // std::max, std::fill_n, std::sort
 #include <cctype>    // std::isdigit (issue #330)
+#include <cmath>     // std::isfinite
 #include <cstring>   // strlen
 #include <limits>    // std::numeric_limits
 #include <map>       // std::multimap
+#include <type_traits>
 
 // ===== OpenXLSX Includes ===== //
 #include "XLCellRange.hpp"
 #include "XLDocument.hpp"
 #include "XLMergeCells.hpp"
+#include "XLNumberCodec.hpp"
+#include "XLRowIndex.hpp"
+#include "XLSheetBounds.hpp"
 #include "XLSheet.hpp"
 #include "XLXmlParser.hpp"              // pugixml wrapper
 #include "utilities/XLUtilities.hpp"
@@ -1046,10 +1051,9 @@ std::string XLConditionalFormats::summary() const
  */
 XLWorksheet::XLWorksheet(XLXmlData* xmlData) : XLSheetBase(xmlData)
 {
-    // ===== Read the dimensions of the Sheet and set data members accordingly.
-    XMLNode sheetNode = xmlDocument().document_element();
-    sheetNode.remove_child("dimension");    // 2026-06-13: prefer no dimension tag over a wrong one.
-    // NOTE: use XLWorksheet::setDimension right before saving the document to re-establish the dimension XML tag
+    // ===== Read the dimensions of the Sheet and set data members accordingly - through the const document, see XLXmlData::isDirty
+    XMLNode sheetNode = static_cast<const XLWorksheet*>(this)->xmlDocument().document_element();
+    // NOTE: the <dimension> tag is kept: XLDocument updates it from lastCell for each modified worksheet on save
 
     // If Column properties are grouped, divide them into properties for individual Columns.
     if (sheetNode.child("cols").type() != pugi::node_null) {
@@ -1065,6 +1069,7 @@ XLWorksheet::XLWorksheet(XLXmlData* xmlData) : XLSheetBase(xmlData)
                 throw XLInternalError("Worksheet column min and/or max attributes are invalid.");
             }
             if (min != max) {
+                m_xmlData->sheetBounds().markModified();
                 currentNode.attribute("min").set_value(max);
                 for (uint16_t i = min; i < max; i++) {    // NOLINT
                     auto newnode = sheetNode.child("cols").insert_child_before("col", currentNode);
@@ -1194,10 +1199,12 @@ XLCellAssignable XLWorksheet::cell(const XLCellReference& ref) const { return ce
  */
 XLCellAssignable XLWorksheet::cell(uint32_t rowNumber, uint16_t columnNumber) const
 {
-    const XMLNode rowNode  = getRowNode(xmlDocument().document_element().child("sheetData"), rowNumber);
+    const XMLNode rowNode  = m_xmlData->rowIndex().getRow(xmlDocument().document_element().child("sheetData"), rowNumber);
     const XMLNode cellNode = getCellNode(rowNode, columnNumber, rowNumber);
+    XLSheetBounds& bounds  = m_xmlData->sheetBounds();
+    bounds.extend(columnNumber, cellNode);    // the cell may have been created
     // ===== Move-construct XLCellAssignable from temporary XLCell
-    return XLCellAssignable(XLCell(cellNode, parentDoc().sharedStrings()));
+    return XLCellAssignable(XLCell(cellNode, parentDoc().sharedStrings(), &bounds));
 }
 
 /**
@@ -1215,16 +1222,250 @@ XLCellAssignable XLWorksheet::findCell(const XLCellReference& ref) const { retur
  */
 XLCellAssignable XLWorksheet::findCell(uint32_t rowNumber, uint16_t columnNumber) const
 {
-    return XLCellAssignable(XLCell(findCellNode(findRowNode( xmlDocument().document_element().child("sheetData"), rowNumber ), columnNumber), parentDoc().sharedStrings()));
+    const XMLNode rowNode = m_xmlData->rowIndex().findRow(xmlDocument().document_element().child("sheetData"), rowNumber);
+    return XLCellAssignable(XLCell(findCellNode(rowNode, columnNumber), parentDoc().sharedStrings(), &m_xmlData->sheetBounds()));
 }
 
+/**
+ * @details
+ */
+void XLWorksheet::findCells(uint32_t rowNumber, uint16_t firstColumn, uint16_t count, XLCell* cells) const
+{
+    using namespace std::literals::string_literals;
+    if (rowNumber < 1 || rowNumber > OpenXLSX::MAX_ROWS)
+        throw XLCellAddressError("XLWorksheet::"s + __func__ + ": rowNumber "s + std::to_string(rowNumber) + " is outside valid range"s);
+    if (firstColumn < 1 || count > OpenXLSX::MAX_COLS - firstColumn + 1)
+        throw XLCellAddressError("XLWorksheet::"s + __func__ + ": invalid column range"s);
+    for (uint16_t i = 0; i < count; ++i) cells[i] = XLCell();
+
+    const XMLNode rowNode = m_xmlData->rowIndex().findRow(xmlDocument().document_element().child("sheetData"), rowNumber);
+    if (rowNode.empty()) return;
+    const uint16_t lastColumn = firstColumn + count - 1;
+    for (XMLNode cellNode = rowNode.first_child_of_type(pugi::node_element); not cellNode.empty();
+         cellNode         = cellNode.next_sibling_of_type(pugi::node_element))
+    {
+        const uint16_t column = getCellColumn(cellNode);
+        if (column > lastColumn) break;
+        if (column >= firstColumn) cells[column - firstColumn] = XLCell(cellNode, parentDoc().sharedStrings(), &m_xmlData->sheetBounds());
+    }
+}
+
+namespace
+{
+    /**
+     * @brief decode the value of a cell node straight from its XML, the way XLCellValueProxy::getValue would
+     * @return true if the cell holds a value of type T, which is then stored in value
+     */
+    template<typename T>
+    bool decodeCellValue(const XMLNode& cellNode, T& value)
+    {
+        const XMLNode valueNode = cellNode.child("v");
+        if (valueNode.empty()) return false;
+        const char* type = cellNode.attribute("t").value();
+        const char* text = valueNode.text().get();
+        if (*text == 0) return false;
+
+        if constexpr (std::is_same_v<T, bool>) {
+            if (strcmp(type, "b") != 0) return false;
+            value = (*text == '1' || *text == 't' || *text == 'T');    // same as pugixml's as_bool
+            return true;
+        }
+        else {
+            if (*type != 0 && strcmp(type, "n") != 0) return false;    // not a number
+            if constexpr (std::is_floating_point_v<T>)
+                value = XLNumberCodec::parseDouble(text);
+            else {
+                if (XLNumberCodec::isFloatingPoint(text)) return false;    // no implicit conversion of a float to an integer
+                value = XLNumberCodec::parseInteger(text);
+            }
+            return true;
+        }
+    }
+}    // namespace
+
+/**
+ * @details The rows are walked once, starting from the first row at or after firstRow, and the cells of each row are walked only
+ *  up to the highest requested column. Cells are matched against the requested columns in ascending column order.
+ */
+template<typename T>
+size_t XLWorksheet::readColumns(const std::vector<uint16_t>& columns, uint32_t firstRow, uint32_t lastRow, T* const* out,
+                                uint8_t* const* validity) const
+{
+    using namespace std::literals::string_literals;
+    if (firstRow < 1 || lastRow < firstRow || lastRow > OpenXLSX::MAX_ROWS)
+        throw XLCellAddressError("XLWorksheet::"s + __func__ + ": invalid row range ["s + std::to_string(firstRow) + ";"s + std::to_string(lastRow) + "]"s);
+    for (const uint16_t column : columns)
+        if (column < 1 || column > OpenXLSX::MAX_COLS)
+            throw XLCellAddressError("XLWorksheet::"s + __func__ + ": column "s + std::to_string(column) + " is outside valid range"s);
+
+    // ===== Reset all values and validity bits, so that missing cells need no further handling
+    const size_t rowCount = lastRow - firstRow + 1;
+    for (size_t k = 0; k < columns.size(); ++k) {
+        std::fill_n(out[k], rowCount, T {});
+        if (validity != nullptr) std::fill_n(validity[k], (rowCount + 7) / 8, uint8_t { 0 });
+    }
+
+    // ===== Match the cells in ascending column order
+    std::vector<size_t> order(columns.size());
+    for (size_t k = 0; k < order.size(); ++k) order[k] = k;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return columns[a] < columns[b]; });
+
+    size_t  validCount = 0;
+    XMLNode rowNode    = m_xmlData->rowIndex().lowerBound(xmlDocument().document_element().child("sheetData"), firstRow);
+    for (; not rowNode.empty(); rowNode = rowNode.next_sibling_of_type(pugi::node_element)) {
+        const uint32_t rowNumber = static_cast<uint32_t>(rowNode.attribute("r").as_ullong());
+        if (rowNumber > lastRow) break;
+        if (rowNumber < firstRow) continue;    // a row without valid row number
+        const size_t index = rowNumber - firstRow;
+
+        size_t next = 0;    // position in order of the next requested column
+        for (XMLNode cellNode = rowNode.first_child_of_type(pugi::node_element); not cellNode.empty() && next < order.size();
+             cellNode         = cellNode.next_sibling_of_type(pugi::node_element))
+        {
+            const uint16_t column = getCellColumn(cellNode);
+            while (next < order.size() && columns[order[next]] < column) ++next;
+            for (; next < order.size() && columns[order[next]] == column; ++next) {    // a column may have been requested repeatedly
+                const size_t k = order[next];
+                if (not decodeCellValue(cellNode, out[k][index])) continue;
+                if (validity != nullptr) validity[k][index / 8] |= static_cast<uint8_t>(1u << (index % 8));
+                ++validCount;
+            }
+        }
+    }
+    return validCount;
+}
+
+template size_t XLWorksheet::readColumns<double>(const std::vector<uint16_t>&, uint32_t, uint32_t, double* const*, uint8_t* const*) const;
+template size_t XLWorksheet::readColumns<int64_t>(const std::vector<uint16_t>&, uint32_t, uint32_t, int64_t* const*, uint8_t* const*) const;
+template size_t XLWorksheet::readColumns<bool>(const std::vector<uint16_t>&, uint32_t, uint32_t, bool* const*, uint8_t* const*) const;
+
+namespace
+{
+    /**
+     * @brief write a number to the \<v\> node of a new cell, like XLCellValueProxy::setFloat / setInteger
+     */
+    void writeNewCellValue(XMLNode& cellNode, double value)
+    {
+        if (not std::isfinite(value)) {    // same as XLCellValueProxy::setFloat
+            cellNode.append_attribute("t").set_value("e");
+            cellNode.append_child("v").text().set("#NUM!");
+            return;
+        }
+        char number[XLMaxNumberChars];
+        XLNumberCodec::format(value, number);
+        cellNode.append_child("v").text().set(number);
+    }
+
+    void writeNewCellValue(XMLNode& cellNode, int64_t value)
+    {
+        char number[XLMaxNumberChars];
+        XLNumberCodec::format(value, number);
+        cellNode.append_child("v").text().set(number);
+    }
+
+    void writeNewCellValue(XMLNode& cellNode, bool value)
+    {
+        cellNode.append_attribute("t").set_value("b");
+        cellNode.append_child("v").text().set(value ? "1" : "0");
+    }
+
+    /**
+     * @brief write a string to a new cell: as shared string if sharedIndex >= 0, otherwise as inline string
+     */
+    void writeNewCellValue(XMLNode& cellNode, const std::string& value, int32_t sharedIndex)
+    {
+        if (sharedIndex >= 0) {
+            cellNode.append_attribute("t").set_value("s");
+            cellNode.append_child("v").text().set(sharedIndex);
+            return;
+        }
+        cellNode.append_attribute("t").set_value("inlineStr");
+        XMLNode textNode = cellNode.append_child("is").append_child("t");
+        if ((!value.empty()) && (value.front() == ' ' || value.back() == ' '))
+            textNode.append_attribute("xml:space").set_value("preserve");    // preserve spaces at begin/end of string
+        textNode.text().set(value.c_str());
+    }
+}    // namespace
+
+/**
+ * @details Each row of the block is fetched once through the row index, and its cells are merged with the block columns in a
+ *  single pass: a cell that exists already is assigned through XLCellValueProxy, all other cells are created at their ordered
+ *  position and written without the cleanup that an existing value would require.
+ */
+template<typename T>
+void XLWorksheet::writeBlock(const XLCellReference& topLeft, uint32_t rows, uint16_t cols, const T* data, size_t stride)
+{
+    using namespace std::literals::string_literals;
+    if (rows == 0 || cols == 0) return;
+    const uint32_t firstRow = topLeft.row();
+    const uint16_t firstCol = topLeft.column();
+    if (rows > OpenXLSX::MAX_ROWS - firstRow + 1 || cols > OpenXLSX::MAX_COLS - firstCol + 1)
+        throw XLCellAddressError("XLWorksheet::"s + __func__ + ": block of "s + std::to_string(rows) + "x"s + std::to_string(cols) +
+                                 " cells at "s + topLeft.address() + " exceeds the worksheet bounds"s);
+    if (stride == 0) stride = cols;
+    m_xmlData->sheetBounds().extend(static_cast<uint16_t>(firstCol + cols - 1));
+
+    const XLSharedStrings& sharedStrings = parentDoc().sharedStrings();
+    XMLNode                sheetDataNode = xmlDocument().document_element().child("sheetData");
+
+    // ===== Column letters and column styles are the same for all rows of the block
+    std::vector<std::string> columnLetters(cols);
+    for (uint16_t c = 0; c < cols; ++c) columnLetters[c] = XLCellReference::columnAsString(static_cast<uint16_t>(firstCol + c));
+    std::vector<XLStyleIndex> colStyles(firstCol + cols - 1, XLDefaultCellFormat);
+
+    for (uint32_t r = 0; r < rows; ++r) {
+        const uint32_t    rowNumber = firstRow + r;
+        XMLNode           rowNode   = m_xmlData->rowIndex().getRow(sheetDataNode, rowNumber);
+        const std::string rowString = std::to_string(rowNumber);
+        if (r == 0)
+            for (uint16_t c = 0; c < cols; ++c) colStyles[firstCol + c - 1] = getColumnStyle(rowNode, static_cast<uint16_t>(firstCol + c));
+
+        // ===== Position on the first existing cell at or after firstCol - in a row without cells beyond firstCol, all cells are new
+        XMLNode  next       = rowNode.last_child_of_type(pugi::node_element);
+        uint16_t nextColumn = next.empty() ? 0 : getCellColumn(next);
+        if (nextColumn < firstCol)
+            next = XMLNode {};
+        else {
+            next = rowNode.first_child_of_type(pugi::node_element);
+            while ((nextColumn = getCellColumn(next)) < firstCol) next = next.next_sibling_of_type(pugi::node_element);
+        }
+
+        const T* rowData = data + r * stride;
+        for (uint16_t c = 0; c < cols; ++c) {
+            const uint16_t column = firstCol + c;
+            if (not next.empty() && nextColumn == column) {    // existing cell
+                XLCell(next, sharedStrings).value() = rowData[c];
+                next = next.next_sibling_of_type(pugi::node_element);
+                if (not next.empty()) nextColumn = getCellColumn(next);
+                continue;
+            }
+
+            XMLNode cellNode = next.empty() ? rowNode.append_child("c") : rowNode.insert_child_before("c", next);
+            setDefaultCellAttributes(cellNode, columnLetters[c] + rowString, rowNode, column, colStyles);
+            if constexpr (std::is_same_v<T, std::string>) {
+                const int32_t index = sharedStrings.getOrAppendStringByPolicy(rowData[c]);
+                if (index >= 0) sharedStrings.retainString(index);
+                writeNewCellValue(cellNode, rowData[c], index);
+            }
+            else
+                writeNewCellValue(cellNode, rowData[c]);
+        }
+    }
+}
+
+template void XLWorksheet::writeBlock<double>(const XLCellReference&, uint32_t, uint16_t, const double*, size_t);
+template void XLWorksheet::writeBlock<int64_t>(const XLCellReference&, uint32_t, uint16_t, const int64_t*, size_t);
+template void XLWorksheet::writeBlock<bool>(const XLCellReference&, uint32_t, uint16_t, const bool*, size_t);
+template void XLWorksheet::writeBlock<std::string>(const XLCellReference&, uint32_t, uint16_t, const std::string*, size_t);
+
 /**
  * @details
  */
 void XLWorksheet::setDimension(XLCellReference topLeft, XLCellReference bottomRight, bool autoCalculateLastCell)
 {
     // ===== Establish & validate corners
-    if (bottomRight.row() == 1 && bottomRight.column() == 1 && autoCalculateLastCell)   // if bottomRight is A1 and last cell shall be auto-calculated
+    const bool calculateLastCell = (bottomRight.row() == 1 && bottomRight.column() == 1 && autoCalculateLastCell);
+    if (calculateLastCell)                                                                  // if bottomRight is A1 and last cell shall be auto-calculated
         bottomRight = lastCell();                                                           // calculate the last cell in the sheet
     if (bottomRight.row() < topLeft.row() || bottomRight.column() < topLeft.column() )
         throw XLException("XLWorksheet::setDimension: bottomRight row and column must be greater or equal to topLeft row and column respectively");
@@ -1237,10 +1478,10 @@ void XLWorksheet::setDimension(XLCellReference topLeft, XLCellReference bottomRi
     }
 
     // ===== Set dimension of the worksheet
-    XMLNode dimensionNode = xmlDocument().document_element().child("dimension");
-    if (dimensionNode.empty())  // ensure dimension node exists
-        dimensionNode = xmlDocument().document_element().prepend_child("dimension");
+    XMLNode sheetNode     = xmlDocument().document_element();
+    XMLNode dimensionNode = appendAndGetNode(sheetNode, "dimension", m_nodeOrder);    // ensure dimension node exists at its ordered position
     appendAndSetAttribute(dimensionNode, "ref", dimension);
+    m_xmlData->sheetBounds().setExplicitDimension(!calculateLastCell);    // an automatic dimension is updated on save
 }
 
 /**
@@ -1274,7 +1515,9 @@ XLCellRange XLWorksheet::range(const XLCellReference& topLeft, const XLCellRefer
     return XLCellRange(xmlDocument().document_element().child("sheetData"),
                        topLeft,
                        bottomRight,
-                       parentDoc().sharedStrings());
+                       parentDoc().sharedStrings(),
+                       &m_xmlData->sheetBounds(),
+                       &m_xmlData->rowIndex());
 }
 
 /**
@@ -1307,7 +1550,8 @@ XLRowRange XLWorksheet::rows() const    // 2024-04-29: patched for whitespace
                       (sheetDataNode.last_child_of_type(pugi::node_element).empty()
                            ? 1
                            : static_cast<uint32_t>(sheetDataNode.last_child_of_type(pugi::node_element).attribute("r").as_ullong())),
-                      parentDoc().sharedStrings());
+                      parentDoc().sharedStrings(),
+                      &m_xmlData->sheetBounds());
 }
 
 /**
@@ -1320,7 +1564,8 @@ XLRowRange XLWorksheet::rows(uint32_t rowCount) const
     return XLRowRange(xmlDocument().document_element().child("sheetData"),
                       1,
                       rowCount,
-                      parentDoc().sharedStrings());
+                      parentDoc().sharedStrings(),
+                      &m_xmlData->sheetBounds());
 }
 
 /**
@@ -1333,7 +1578,8 @@ XLRowRange XLWorksheet::rows(uint32_t firstRow, uint32_t lastRow) const
     return XLRowRange(xmlDocument().document_element().child("sheetData"),
                       firstRow,
                       lastRow,
-                      parentDoc().sharedStrings());
+                      parentDoc().sharedStrings(),
+                      &m_xmlData->sheetBounds());
 }
 
 /**
@@ -1343,8 +1589,10 @@ XLRowRange XLWorksheet::rows(uint32_t firstRow, uint32_t lastRow) const
  */
 XLRow XLWorksheet::row(uint32_t rowNumber) const
 {
-    return XLRow { getRowNode(xmlDocument().document_element().child("sheetData"), rowNumber),
-                   parentDoc().sharedStrings() };
+    const XMLNode  rowNode = m_xmlData->rowIndex().getRow(xmlDocument().document_element().child("sheetData"), rowNumber);
+    XLSheetBounds& bounds  = m_xmlData->sheetBounds();
+    if (rowNode.first_child().empty()) bounds.markModified();    // the row may have been created
+    return XLRow { rowNode, parentDoc().sharedStrings(), &bounds };
 }
 
 /**
@@ -1359,6 +1607,8 @@ XLColumn XLWorksheet::column(uint16_t columnNumber) const
     if (columnNumber < 1 || columnNumber > OpenXLSX::MAX_COLS)    // 2024-08-05: added range check
         throw XLException("XLWorksheet::column: columnNumber "s + std::to_string(columnNumber) + " is outside allowed range [1;"s + std::to_string(MAX_COLS) + "]"s);
 
+    m_xmlData->sheetBounds().markModified();    // the column node may be created, and XLColumn permits modification
+
     // If no columns exists, create the <cols> node in the XML document.
     if (xmlDocument().document_element().child("cols").empty())
         xmlDocument().document_element().insert_child_before("cols", xmlDocument().document_element().child("sheetData"));
@@ -1452,19 +1702,12 @@ XLCellReference XLWorksheet::lastCell() const noexcept {
 }
 
 /**
- * @details Iterates through the rows and finds the maximum number of cells.
+ * @details The highest column number of any cell, as cached by XLSheetBounds - the rows are only visited on first use and
+ *  when the cache has been invalidated.
  */
 uint16_t XLWorksheet::columnCount() const noexcept
 {
-    uint16_t maxCount = 0;    // Pull request: Update XLSheet.cpp with correct type #176, Explicitely cast to unsigned short int #163
-    XLRowRange rowsRange = rows();
-    for (XLRowIterator rowIt = rowsRange.begin(); rowIt != rowsRange.end(); ++rowIt ) {
-        if (rowIt.rowExists()) {
-            uint16_t cellCount = rowIt->cellCount();
-            maxCount = std::max(cellCount, maxCount);
-        }
-    }
-    return maxCount;
+    return m_xmlData->sheetBounds().lastColumn(xmlDocument().document_element().child("sheetData"));
 }
 
 /**
@@ -1477,30 +1720,15 @@ uint32_t XLWorksheet::rowCount() const noexcept
 }
 
 /**
- * @details finds a given row and deletes it
+ * @details finds a given row through the row index and deletes it, after passing its last column to XLSheetBounds::shrink
  */
 bool XLWorksheet::deleteRow(uint32_t rowNumber)
 {
-    XMLNode row = xmlDocument().document_element().child("sheetData").first_child_of_type(pugi::node_element);
-    XMLNode lastRow = xmlDocument().document_element().child("sheetData").last_child_of_type(pugi::node_element);
-
-    // ===== Fail if rowNumber is not in XML
-    if (rowNumber < row.attribute("r").as_ullong() || rowNumber > lastRow.attribute("r").as_ullong()) return false;
-
-    // ===== If rowNumber is closer to first (existing) row than to last row, search forwards
-    if (rowNumber - row.attribute("r").as_ullong() < lastRow.attribute("r").as_ullong() - rowNumber)
-        while (not row.empty() && (row.attribute("r").as_ullong() < rowNumber)) row = row.next_sibling_of_type(pugi::node_element);
-
-    // ===== Otherwise, search backwards
-    else {
-        row = lastRow;
-        while (not row.empty() && (row.attribute("r").as_ullong() > rowNumber)) row = row.previous_sibling_of_type(pugi::node_element);
-    }
-
-    if (row.attribute("r").as_ullong() != rowNumber) return false;    // row not found in XML
-
-    // ===== If row was located: remove it
-    return xmlDocument().document_element().child("sheetData").remove_child(row);
+    if (rowNumber < 1 || rowNumber > OpenXLSX::MAX_ROWS) return false;
+    const XMLNode sheetDataNode = xmlDocument().document_element().child("sheetData");
+    const XMLNode lastCellNode  = m_xmlData->rowIndex().findRow(sheetDataNode, rowNumber).last_child_of_type(pugi::node_element);
+    if (not lastCellNode.empty()) m_xmlData->sheetBounds().shrink(getCellColumn(lastCellNode));    // the widest row may be deleted
+    return m_xmlData->rowIndex().deleteRow(sheetDataNode, rowNumber);
 }
 
 /**
@@ -1521,25 +1749,21 @@ void XLWorksheet::updateSheetName(const std::string& oldName, const std::string&
     oldNameTemp += '!';
     newNameTemp += '!';
 
-    // ===== Iterate through all defined names
-    XMLNode row = xmlDocument().document_element().child("sheetData").first_child_of_type(pugi::node_element);
-    for (; not row.empty(); row = row.next_sibling_of_type(pugi::node_element)) {
-        for (XMLNode cell = row.first_child_of_type(pugi::node_element);
-             not cell.empty();
-             cell         = cell.next_sibling_of_type(pugi::node_element))
-        {
-            if (!XLCell(cell, parentDoc().sharedStrings()).hasFormula()) continue;
+    // ===== Iterate through all existing cells of the whole sheet - not only range(), which is bounded by lastCell
+    for (XLCell& cell : range(XLCellReference(1, 1), XLCellReference(MAX_ROWS, MAX_COLS)).existingCells()) {
+        if (!cell.hasFormula()) continue;
 
-            formula = XLCell(cell, parentDoc().sharedStrings()).formula().get();
+        formula = cell.formula().get();
 
-            // ===== Skip if formula contains a '[' and ']' (means that the defined refers to external workbook)
-            if (formula.find('[') == std::string::npos && formula.find(']') == std::string::npos) {
-                // ===== For all instances of the old sheet name in the formula, replace with the new name.
-                while (formula.find(oldNameTemp) != std::string::npos) {    // NOLINT
-                    formula.replace(formula.find(oldNameTemp), oldNameTemp.length(), newNameTemp);
-                }
-                XLCell(cell, parentDoc().sharedStrings()).formula() = formula;
+        // ===== Skip if formula contains a '[' and ']' (means that the defined refers to external workbook)
+        if (formula.find('[') == std::string::npos && formula.find(']') == std::string::npos) {
+            // ===== For all instances of the old sheet name in the formula, replace with the new name.
+            bool replaced = false;
+            while (formula.find(oldNameTemp) != std::string::npos) {    // NOLINT
+                formula.replace(formula.find(oldNameTemp), oldNameTemp.length(), newNameTemp);
+                replaced = true;
             }
+            if (replaced) cell.formula() = formula;    // leave the other formulas (and the worksheet) unmodified
         }
     }
 }
@@ -1549,6 +1773,7 @@ void XLWorksheet::updateSheetName(const std::string& oldName, const std::string&
  */
 XLMergeCells & XLWorksheet::merges()
 {
+    m_xmlData->sheetBounds().markModified();    // XLMergeCells permits modification
     if (!m_merges.valid())
         m_merges = XLMergeCells(xmlDocument().document_element(), m_nodeOrder);
     return m_merges;
@@ -1662,7 +1887,11 @@ bool XLWorksheet::setRowFormat(uint32_t rowNumber, XLStyleIndex cellFormatIndex)
 /**
  * @details Provide access to worksheet conditional formats
  */
-XLConditionalFormats XLWorksheet::conditionalFormats() const { return XLConditionalFormats(xmlDocument().document_element()); }
+XLConditionalFormats XLWorksheet::conditionalFormats() const
+{
+    m_xmlData->sheetBounds().markModified();    // XLConditionalFormats permits modification
+    return XLConditionalFormats(xmlDocument().document_element());
+}
 
 /**
  * @brief Set the <sheetProtection> attributes sheet, objects and scenarios respectively
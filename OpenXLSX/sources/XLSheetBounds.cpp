@@ -0,0 +1,103 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+// ===== External Includes ===== //
+#include <algorithm>    // std::max
+
+// ===== OpenXLSX Includes ===== //
+#include "XLSheetBounds.hpp"
+#include "XLXmlParser.hpp"
+#include "utilities/XLUtilities.hpp"
+
+using namespace OpenXLSX;
+
+/**
+ * @details If the extent is not known, it is determined from the last cell of each row, which is one node lookup per row. The
+ *  <dimension> tag is not used: it may have been written by another producer, and a too narrow dimension would hide cells from
+ *  lastCell and everything bounded by it.
+ */
+uint16_t XLSheetBounds::lastColumn(XMLNode sheetDataNode)
+{
+    if (m_known) return m_lastColumn;
+
+    m_lastColumn = 0;
+    for (XMLNode row = sheetDataNode.first_child_of_type(pugi::node_element); not row.empty();
+         row         = row.next_sibling_of_type(pugi::node_element))
+    {
+        const XMLNode lastCell = row.last_child_of_type(pugi::node_element);
+        if (not lastCell.empty()) m_lastColumn = std::max(m_lastColumn, getCellColumn(lastCell));
+    }
+    m_known = true;
+    return m_lastColumn;
+}
+
+/**
+ * @details
+ */
+void XLSheetBounds::extend(uint16_t column, const XMLNode& cellNode)
+{
+    if (column > m_lastColumn) m_lastColumn = column;
+    if (cellNode.first_child().empty()) m_modified = true;
+}
+
+/**
+ * @details Deleting cells left of the extent does not change it. Otherwise, the extent can only be determined from the XML.
+ */
+void XLSheetBounds::shrink(uint16_t column)
+{
+    m_modified = true;
+    if (m_known && column < m_lastColumn) return;
+    m_lastColumn = 0;
+    m_known      = false;
+}
+
+/**
+ * @details
+ */
+void XLSheetBounds::clear()
+{
+    m_lastColumn = 0;
+    m_known      = false;
+}
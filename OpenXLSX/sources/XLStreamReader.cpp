@@ -0,0 +1,662 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+// ===== External Includes ===== //
+#include <algorithm>    // std::copy, std::copy_n
+#include <cerrno>       // errno, ERANGE
+#include <cstdint>      // uint16_t, uint32_t, uint64_t
+#include <cstdlib>      // std::strtoull
+#ifdef CHARCONV_ENABLED
+#    include <charconv>
+#endif
+
+// ===== OpenXLSX Includes ===== //
+#include "XLConstants.hpp"
+#include "XLDocument.hpp"
+#include "XLException.hpp"
+#include "XLNumberCodec.hpp"
+#include "XLStreamReader.hpp"
+#include "XLXmlData.hpp"
+
+using namespace OpenXLSX;
+
+namespace
+{
+    constexpr size_t XLStreamBufferSize = 65536; /**< initial size of the read buffer, grows only for tokens that do not fit */
+
+    /**
+     * @brief XLZipEntryStream implementation that serves XML data held in memory, used for worksheets that have been modified
+     */
+    class XLStringEntryStream : public XLZipEntryStream
+    {
+    public:
+        explicit XLStringEntryStream(std::string data) : m_data(std::move(data)) {}
+
+        size_t read(char* buffer, size_t size) override
+        {
+            const size_t count = (std::min)(size, m_data.size() - m_pos);
+            std::copy_n(m_data.data() + m_pos, count, buffer);
+            m_pos += count;
+            return count;
+        }
+
+    private:
+        std::string m_data;
+        size_t      m_pos {0};
+    };
+
+    /**
+     * @brief strip a namespace prefix from an XML name
+     */
+    std::string_view localName(std::string_view name)
+    {
+        const size_t pos = name.find(':');
+        return pos == std::string_view::npos ? name : name.substr(pos + 1);
+    }
+
+    /**
+     * @brief check for XML whitespace
+     */
+    bool isXmlSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+    /**
+     * @brief parse an unsigned decimal number, ignoring any trailing characters
+     */
+    uint32_t parseNumber(std::string_view text)
+    {
+        uint32_t result = 0;
+        for (const char c : text) {
+            if (c < '0' || c > '9') break;
+            result = result * 10 + static_cast<uint32_t>(c - '0');
+        }
+        return result;
+    }
+
+    /**
+     * @brief append a unicode code point to a string in UTF-8 encoding
+     */
+    void appendUtf8(std::string& out, uint32_t codePoint)
+    {
+        if (codePoint < 0x80)
+            out += static_cast<char>(codePoint);
+        else if (codePoint < 0x800) {
+            out += static_cast<char>(0xC0 | (codePoint >> 6));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        else if (codePoint < 0x10000) {
+            out += static_cast<char>(0xE0 | (codePoint >> 12));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        else {
+            out += static_cast<char>(0xF0 | (codePoint >> 18));
+            out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    /**
+     * @brief append XML character data to a string, resolving entity and character references and normalizing line endings
+     *  the same way pugixml does with pugi::parse_default
+     */
+    void appendDecoded(std::string& out, std::string_view raw)
+    {
+        if (raw.find_first_of("&\r") == std::string_view::npos) {
+            out.append(raw);
+            return;
+        }
+
+        for (size_t i = 0; i < raw.size(); ++i) {
+            const char c = raw[i];
+            if (c == '\r') {
+                out += '\n';
+                if (i + 1 < raw.size() && raw[i + 1] == '\n') ++i;
+                continue;
+            }
+            if (c == '&') {
+                const size_t semicolon = raw.find(';', i + 1);
+                if (semicolon != std::string_view::npos) {
+                    const std::string_view entity = raw.substr(i + 1, semicolon - i - 1);
+                    bool resolved = true;
+                    if (entity == "lt") out += '<';
+                    else if (entity == "gt") out += '>';
+                    else if (entity == "amp") out += '&';
+                    else if (entity == "quot") out += '"';
+                    else if (entity == "apos") out += '\'';
+                    else if (entity.size() > 1 && entity[0] == '#') {
+                        const bool hex = (entity[1] == 'x');
+                        const std::string digits(entity.substr(hex ? 2 : 1));
+                        char* parseEnd = nullptr;
+                        const unsigned long codePoint = std::strtoul(digits.c_str(), &parseEnd, hex ? 16 : 10);
+                        resolved = !digits.empty() && *parseEnd == '\0' && codePoint <= 0x10FFFF;
+                        if (resolved) appendUtf8(out, static_cast<uint32_t>(codePoint));
+                    }
+                    else
+                        resolved = false;
+
+                    if (resolved) {
+                        i = semicolon;
+                        continue;
+                    }
+                }
+            }
+            out += c;    // unknown references are kept verbatim
+        }
+    }
+
+    /**
+     * @brief the value types of the cell "t" attribute, see XLCellValueProxy::type
+     */
+    enum class XLStreamCellType : uint8_t { None, Number, SharedString, String, InlineString, Boolean, Other };
+
+    XLStreamCellType cellType(std::string_view typeAttribute, bool present)
+    {
+        if (!present) return XLStreamCellType::None;
+        if (typeAttribute == "n") return XLStreamCellType::Number;
+        if (typeAttribute == "s") return XLStreamCellType::SharedString;
+        if (typeAttribute == "str") return XLStreamCellType::String;
+        if (typeAttribute == "inlineStr") return XLStreamCellType::InlineString;
+        if (typeAttribute == "b") return XLStreamCellType::Boolean;
+        return XLStreamCellType::Other;
+    }
+
+    /**
+     * @brief parse the value text of a shared string cell
+     * @return the shared string index, or -1 if the text is not a valid index into a table of stringCount strings
+     */
+    int32_t parseStringIndex(const std::string& text, int32_t stringCount)
+    {
+        uint64_t value = 0;
+#ifdef CHARCONV_ENABLED
+        const auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (result.ec != std::errc() || result.ptr != text.data() + text.size()) return -1;
+#else
+        char* end = nullptr;
+        errno     = 0;
+        value     = std::strtoull(text.c_str(), &end, 10);
+        if (text.empty() || text.front() < '0' || text.front() > '9' || errno == ERANGE || *end != '\0') return -1;
+#endif
+        return value < static_cast<uint64_t>(stringCount) ? static_cast<int32_t>(value) : -1;
+    }
+}    // namespace
+
+/**
+ * @details The worksheet XML is read from the archive entry, unless the worksheet XML document has been modified, in which case
+ *  the current state of the document is serialized and read from memory. A worksheet that was only read, or whose modifications
+ *  have been written to the archive by the memory budget, is read from the archive entry.
+ */
+XLStreamReader::XLStreamReader(XLXmlData* xmlData)
+    : m_sharedStrings(xmlData->getParentDoc()->sharedStrings()),
+      m_buffer(XLStreamBufferSize)
+{
+    if (xmlData->isDirty())
+        m_stream = std::make_unique<XLStringEntryStream>(xmlData->getRawData());
+    else
+        m_stream = xmlData->getParentDoc()->openEntryStream(xmlData->getXmlPath());
+}
+
+/**
+ * @details
+ */
+XLStreamReader::XLStreamReader(XLStreamReader&& other) noexcept = default;
+
+/**
+ * @details
+ */
+XLStreamReader::~XLStreamReader() = default;
+
+/**
+ * @details
+ */
+XLStreamReader& XLStreamReader::operator=(XLStreamReader&& other) noexcept = default;
+
+/**
+ * @details Skips everything up to the sheetData element, then decodes one row element per call. Elements other than row within
+ *  sheetData are ignored, as are all elements following sheetData.
+ */
+bool XLStreamReader::nextRow()
+{
+    m_values.clear();
+
+    while (!m_finished) {
+        const XLToken token = nextToken();
+        if (token == XLToken::End) {
+            m_finished = true;
+            break;
+        }
+
+        // ===== Advance to the sheetData element
+        if (!m_inSheetData) {
+            if (token == XLToken::StartTag && m_name == "sheetData") {
+                if (m_selfClosing)
+                    m_finished = true;
+                else
+                    m_inSheetData = true;
+            }
+            continue;
+        }
+
+        if (token == XLToken::EndTag && m_name == "sheetData") {
+            m_finished = true;
+            break;
+        }
+        if (token != XLToken::StartTag) continue;
+        if (m_name != "row") {
+            if (!m_selfClosing) skipElement();
+            continue;
+        }
+
+        // ===== A row element: rows without a reference follow the previous row
+        const std::string_view rowReference = attribute("r");
+        m_rowNumber                         = rowReference.empty() ? m_rowNumber + 1 : parseNumber(rowReference);
+        m_column                            = 0;
+        if (m_selfClosing) return true;
+
+        while (true) {
+            const XLToken cellToken = nextToken();
+            if (cellToken == XLToken::End) {
+                using namespace std::literals::string_literals;
+                throw XLInputError("XLStreamReader::"s + __func__ + ": unexpected end of worksheet XML in row "s + std::to_string(m_rowNumber));
+            }
+            if (cellToken == XLToken::EndTag) {
+                if (m_name == "row") return true;
+                continue;
+            }
+            if (cellToken != XLToken::StartTag) continue;
+
+            if (m_name == "c")
+                readCell();
+            else if (!m_selfClosing)
+                skipElement();
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @details
+ */
+uint32_t XLStreamReader::rowNumber() const { return m_rowNumber; }
+
+/**
+ * @details
+ */
+const std::vector<XLCellValue>& XLStreamReader::values() const { return m_values; }
+
+/**
+ * @details Moves unread data to the front of the buffer before reading more, and grows the buffer only if a single token does not
+ *  fit into it. This invalidates the string_views into the buffer (m_name, m_attributes).
+ */
+bool XLStreamReader::require(size_t count)
+{
+    while (m_end - m_begin < count) {
+        if (m_eof) return false;
+
+        if (m_begin > 0) {
+            std::copy(m_buffer.begin() + static_cast<std::ptrdiff_t>(m_begin), m_buffer.begin() + static_cast<std::ptrdiff_t>(m_end), m_buffer.begin());
+            m_end -= m_begin;
+            m_begin = 0;
+        }
+        if (m_end == m_buffer.size()) m_buffer.resize(m_buffer.size() * 2);
+
+        const size_t bytesRead = m_stream->read(m_buffer.data() + m_end, m_buffer.size() - m_end);
+        if (bytesRead == 0) m_eof = true;
+        m_end += bytesRead;
+    }
+    return true;
+}
+
+/**
+ * @details
+ */
+size_t XLStreamReader::find(std::string_view pattern, size_t offset)
+{
+    while (true) {
+        const std::string_view data(m_buffer.data() + m_begin, m_end - m_begin);
+        if (const size_t pos = data.find(pattern, offset); pos != std::string_view::npos) return pos;
+
+        // ===== continue the search with the last (pattern.size() - 1) bytes, in case pattern spans the end of the available data
+        if (data.size() >= pattern.size()) offset = data.size() - pattern.size() + 1;
+        if (!require(data.size() + 1)) return std::string_view::npos;
+    }
+}
+
+/**
+ * @details
+ */
+size_t XLStreamReader::tagEnd()
+{
+    char quote = 0;
+    for (size_t pos = 1;; ++pos) {
+        if (m_end - m_begin <= pos && !require(pos + 1)) {
+            using namespace std::literals::string_literals;
+            throw XLInputError("XLStreamReader::"s + __func__ + ": unexpected end of worksheet XML inside a tag"s);
+        }
+
+        const char c = m_buffer[m_begin + pos];
+        if (quote != 0) {
+            if (c == quote) quote = 0;
+        }
+        else if (c == '"' || c == '\'')
+            quote = c;
+        else if (c == '>')
+            return pos;
+    }
+}
+
+/**
+ * @details
+ */
+XLStreamReader::XLToken XLStreamReader::nextToken()
+{
+    using namespace std::literals::string_literals;
+
+    while (true) {
+        if (!require(1)) return XLToken::End;
+
+        // ===== Character data up to the next tag
+        if (m_buffer[m_begin] != '<') {
+            size_t length = find("<", 0);
+            if (length == std::string_view::npos) length = m_end - m_begin;
+            m_text.clear();
+            appendDecoded(m_text, std::string_view(m_buffer.data() + m_begin, length));
+            m_begin += length;
+            return XLToken::Text;
+        }
+
+        if (!require(2)) throw XLInputError("XLStreamReader::"s + __func__ + ": unexpected end of worksheet XML"s);
+
+        // ===== Processing instructions (including the XML declaration), comments, CDATA sections and declarations
+        if (m_buffer[m_begin + 1] == '?' || m_buffer[m_begin + 1] == '!') {
+            std::string_view terminator = ">";
+            size_t           contentBegin = 0;
+            if (m_buffer[m_begin + 1] == '?')
+                terminator = "?>";
+            else if (require(4) && std::string_view(m_buffer.data() + m_begin, 4) == "<!--")
+                terminator = "-->";
+            else if (require(9) && std::string_view(m_buffer.data() + m_begin, 9) == "<![CDATA[") {
+                terminator   = "]]>";
+                contentBegin = 9;
+            }
+
+            const size_t end = find(terminator, 2);
+            if (end == std::string_view::npos) throw XLInputError("XLStreamReader::"s + __func__ + ": unexpected end of worksheet XML"s);
+
+            if (contentBegin > 0) {
+                m_text.assign(m_buffer.data() + m_begin + contentBegin, end - contentBegin);
+                m_begin += end + terminator.size();
+                return XLToken::Text;
+            }
+            m_begin += end + terminator.size();
+            continue;
+        }
+
+        // ===== Start or end tag
+        const size_t     end = tagEnd();
+        std::string_view tag(m_buffer.data() + m_begin + 1, end - 1);
+        m_begin += end + 1;
+
+        if (!tag.empty() && tag.front() == '/') {
+            tag.remove_prefix(1);
+            while (!tag.empty() && isXmlSpace(tag.back())) tag.remove_suffix(1);
+            m_name = localName(tag);
+            return XLToken::EndTag;
+        }
+
+        m_selfClosing = (!tag.empty() && tag.back() == '/');
+        if (m_selfClosing) tag.remove_suffix(1);
+
+        size_t nameEnd = 0;
+        while (nameEnd < tag.size() && !isXmlSpace(tag[nameEnd])) ++nameEnd;
+        m_name       = localName(tag.substr(0, nameEnd));
+        m_attributes = tag.substr(nameEnd);
+        return XLToken::StartTag;
+    }
+}
+
+/**
+ * @details
+ */
+void XLStreamReader::skipElement()
+{
+    for (int depth = 1; depth > 0;) {
+        switch (nextToken()) {
+            case XLToken::StartTag:
+                if (!m_selfClosing) ++depth;
+                break;
+            case XLToken::EndTag:
+                --depth;
+                break;
+            case XLToken::End: {
+                using namespace std::literals::string_literals;
+                throw XLInputError("XLStreamReader::"s + __func__ + ": unexpected end of worksheet XML"s);
+            }
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @details Appends the character data of the element to text. Nested elements are skipped.
+ */
+void XLStreamReader::readElementText(std::string& text)
+{
+    if (m_selfClosing) return;
+
+    while (true) {
+        switch (nextToken()) {
+            case XLToken::Text:
+                text += m_text;
+                break;
+            case XLToken::StartTag:
+                if (!m_selfClosing) skipElement();
+                break;
+            case XLToken::EndTag:
+                return;
+            default: {
+                using namespace std::literals::string_literals;
+                throw XLInputError("XLStreamReader::"s + __func__ + ": unexpected end of worksheet XML"s);
+            }
+        }
+    }
+}
+
+/**
+ * @details Collects the t element of a plain inline string, or the t elements of all rich text runs (r). Phonetic runs (rPh) and
+ *  run properties are skipped.
+ */
+void XLStreamReader::readInlineString(std::string& text)
+{
+    if (m_selfClosing) return;
+
+    int depth = 1;    // 1: inside is, 2: inside a rich text run
+    while (depth > 0) {
+        switch (nextToken()) {
+            case XLToken::StartTag:
+                if (m_name == "t")
+                    readElementText(text);
+                else if (m_name == "r" && depth == 1) {
+                    if (!m_selfClosing) depth = 2;
+                }
+                else if (!m_selfClosing)
+                    skipElement();
+                break;
+            case XLToken::EndTag:
+                --depth;
+                break;
+            case XLToken::End: {
+                using namespace std::literals::string_literals;
+                throw XLInputError("XLStreamReader::"s + __func__ + ": unexpected end of worksheet XML"s);
+            }
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @details Decodes the cell value following the same rules as XLCellValueProxy::getValue. Cells without a reference follow the
+ *  previous cell in the row.
+ */
+void XLStreamReader::readCell()
+{
+    using namespace std::literals::string_literals;
+
+    // ===== Evaluate the attributes before reading on, as this invalidates m_attributes
+    const std::string_view cellReference = attribute("r");
+    uint16_t               column        = 0;
+    for (const char c : cellReference) {
+        if (c < 'A' || c > 'Z') break;
+        column = static_cast<uint16_t>(column * 26 + (c - 'A' + 1));
+        if (column > MAX_COLS) break;
+    }
+    if (column == 0) column = m_column + 1;
+    if (column > MAX_COLS)
+        throw XLInputError("XLStreamReader::"s + __func__ + ": invalid cell reference in row "s + std::to_string(m_rowNumber));
+    m_column = column;
+
+    const std::string_view typeAttribute = attribute("t");
+    const XLStreamCellType type          = cellType(typeAttribute, typeAttribute.data() != nullptr);
+
+    // ===== Read the value (v) or inline string (is) element
+    bool hasValue = false;
+    m_valueText.clear();
+    if (!m_selfClosing) {
+        while (true) {
+            const XLToken token = nextToken();
+            if (token == XLToken::End) throw XLInputError("XLStreamReader::"s + __func__ + ": unexpected end of worksheet XML"s);
+            if (token == XLToken::EndTag) break;
+            if (token != XLToken::StartTag) continue;
+
+            if (m_name == "v" && type != XLStreamCellType::InlineString) {
+                m_valueText.clear();
+                readElementText(m_valueText);
+                hasValue = true;
+            }
+            else if (m_name == "is" && type == XLStreamCellType::InlineString) {
+                m_valueText.clear();
+                readInlineString(m_valueText);
+            }
+            else if (!m_selfClosing)
+                skipElement();
+        }
+    }
+
+    if (m_values.size() < column) m_values.resize(column);
+    XLCellValue& value = m_values[column - 1];
+
+    switch (type) {
+        case XLStreamCellType::None:
+        case XLStreamCellType::Number:
+            if (!hasValue) {
+                if (type == XLStreamCellType::None)
+                    value.clear();
+                else
+                    value.setError(m_valueText);    // same as XLCellValueProxy: t="n" without a value is not a number
+            }
+            else if (XLNumberCodec::isFloatingPoint(m_valueText.c_str()))
+                value = XLNumberCodec::parseDouble(m_valueText.c_str());
+            else
+                value = XLNumberCodec::parseInteger(m_valueText.c_str());
+            break;
+
+        case XLStreamCellType::SharedString: {
+            const int32_t index = parseStringIndex(m_valueText, m_sharedStrings.get().stringCount());
+            if (index < 0)
+                throw XLInputError("XLStreamReader::"s + __func__ + ": invalid shared string index \""s + m_valueText + "\" in row "s +
+                                   std::to_string(m_rowNumber));
+            value = m_sharedStrings.get().getString(index);
+            break;
+        }
+
+        case XLStreamCellType::String:
+        case XLStreamCellType::InlineString:
+            value = m_valueText;
+            break;
+
+        case XLStreamCellType::Boolean: {
+            const char first = m_valueText.empty() ? '\0' : m_valueText.front();
+            value            = (first == '1' || first == 't' || first == 'T' || first == 'y' || first == 'Y');    // as pugi as_bool
+            break;
+        }
+
+        default:
+            value.setError(m_valueText);
+            break;
+    }
+}
+
+/**
+ * @details Attribute values are returned undecoded, which is sufficient for the attributes evaluated by XLStreamReader.
+ *  A present attribute with an empty value is returned as an empty string_view with a non-null data pointer.
+ */
+std::string_view XLStreamReader::attribute(std::string_view name) const
+{
+    const std::string_view attributes = m_attributes;
+    size_t                 pos        = 0;
+    while (pos < attributes.size()) {
+        while (pos < attributes.size() && isXmlSpace(attributes[pos])) ++pos;
+        const size_t equals = attributes.find('=', pos);
+        if (equals == std::string_view::npos) break;
+
+        std::string_view attributeName = attributes.substr(pos, equals - pos);
+        while (!attributeName.empty() && isXmlSpace(attributeName.back())) attributeName.remove_suffix(1);
+
+        pos = equals + 1;
+        while (pos < attributes.size() && isXmlSpace(attributes[pos])) ++pos;
+        if (pos >= attributes.size()) break;
+        const char   quote    = attributes[pos];
+        const size_t valueEnd = attributes.find(quote, pos + 1);
+        if (valueEnd == std::string_view::npos) break;
+
+        const std::string_view value = attributes.substr(pos + 1, valueEnd - pos - 1);
+        pos                          = valueEnd + 1;
+        if (localName(attributeName) == name) return value;
+    }
+    return {};
+}
@@ -0,0 +1,262 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+// ===== External Includes ===== //
+#include <utility>    // std::move
+
+// ===== OpenXLSX Includes ===== //
+#include "XLCellReference.hpp"
+#include "XLConstants.hpp"
+#include "XLDocument.hpp"
+#include "XLException.hpp"
+#include "XLNumberCodec.hpp"
+#include "XLStreamWriter.hpp"
+
+using namespace OpenXLSX;
+
+namespace
+{
+    constexpr size_t XLStreamFlushSize = 65536; /**< serialized XML is passed on to the archive entry in chunks of about this size */
+
+    // ===== The worksheet XML surrounding the sheetData rows, same as the worksheet created by XLWorkbook::addWorksheet
+    //       except for the dimension element, which is optional and not known up front
+    constexpr const char* XLStreamWorksheetHeader =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+        "<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\""
+        " xmlns:r=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships\""
+        " xmlns:mc=\"http://schemas.openxmlformats.org/markup-compatibility/2006\" mc:Ignorable=\"x14ac\""
+        " xmlns:x14ac=\"http://schemas.microsoft.com/office/spreadsheetml/2009/9/ac\">"
+        "<sheetViews>"
+        "<sheetView workbookViewId=\"0\"/>"
+        "</sheetViews>"
+        "<sheetFormatPr baseColWidth=\"10\" defaultRowHeight=\"16\" x14ac:dyDescent=\"0.2\"/>"
+        "<sheetData>";
+
+    constexpr const char* XLStreamWorksheetFooter =
+        "</sheetData>"
+        "<pageMargins left=\"0.7\" right=\"0.7\" top=\"0.75\" bottom=\"0.75\" header=\"0.3\" footer=\"0.3\"/>"
+        "</worksheet>";
+
+    /**
+     * @brief append text to an XML string, escaping it like pugixml escapes character data: the markup characters, and the
+     *  control characters other than tab, line feed and carriage return as numeric character references
+     */
+    void appendEscaped(std::string& out, const std::string& text)
+    {
+        for (const char c : text) {
+            switch (c) {
+                case '&':
+                    out += "&amp;";
+                    break;
+                case '<':
+                    out += "&lt;";
+                    break;
+                case '>':
+                    out += "&gt;";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 32 && c != '\t' && c != '\n' && c != '\r') {
+                        out += "&#";
+                        out += std::to_string(static_cast<int>(c));
+                        out += ';';
+                    }
+                    else
+                        out += c;
+                    break;
+            }
+        }
+    }
+}    // namespace
+
+/**
+ * @details Opens the archive entry and writes the worksheet XML up to the start of the sheetData element
+ */
+XLStreamWriter::XLStreamWriter(XLDocument* document, std::string sheetName)
+    : m_document(document),
+      m_sheetName(std::move(sheetName)),
+      m_entry(document->openEntryWriter())
+{
+    m_buffer.reserve(XLStreamFlushSize + 4096);
+    m_buffer += XLStreamWorksheetHeader;
+}
+
+/**
+ * @details
+ */
+XLStreamWriter::XLStreamWriter(XLStreamWriter&& other) noexcept = default;
+
+/**
+ * @details The archive entry writer releases any data written so far.
+ */
+XLStreamWriter::~XLStreamWriter() = default;
+
+/**
+ * @details
+ */
+XLStreamWriter& XLStreamWriter::operator=(XLStreamWriter&& other) noexcept = default;
+
+/**
+ * @details Serializes the values the same way XLCellValueProxy stores them: numbers without a type attribute, booleans as t="b",
+ *  errors as t="e" and strings as the string write policy of the document demands.
+ */
+void XLStreamWriter::appendRow(const std::vector<XLCellValue>& values)
+{
+    using namespace std::literals::string_literals;
+
+    if (!m_entry) throw XLInputError("XLStreamWriter::"s + __func__ + ": writer has been closed"s);
+    if (m_rowNumber >= MAX_ROWS) throw XLInputError("XLStreamWriter::"s + __func__ + ": worksheet is full"s);
+    if (values.size() > MAX_COLS) throw XLInputError("XLStreamWriter::"s + __func__ + ": row has more than MAX_COLS values"s);
+
+    const std::string rowString = std::to_string(++m_rowNumber);
+    m_buffer += "<row r=\"";
+    m_buffer += rowString;
+    m_buffer += "\">";
+
+    for (size_t index = 0; index < values.size(); ++index) {
+        const XLCellValue& value = values[index];
+        if (value.type() == XLValueType::Empty) continue;
+
+        m_buffer += "<c r=\"";
+        m_buffer += XLCellReference::columnAsString(static_cast<uint16_t>(index + 1));
+        m_buffer += rowString;
+        m_buffer += '"';
+
+        switch (value.type()) {
+            case XLValueType::Boolean:
+                m_buffer += value.get<bool>() ? " t=\"b\"><v>1</v></c>" : " t=\"b\"><v>0</v></c>";
+                break;
+
+            case XLValueType::Integer: {
+                char number[XLMaxNumberChars];
+                m_buffer += "><v>";
+                m_buffer.append(number, XLNumberCodec::format(value.get<int64_t>(), number));
+                m_buffer += "</v></c>";
+            } break;
+
+            case XLValueType::Float: {
+                char number[XLMaxNumberChars];
+                m_buffer += "><v>";
+                m_buffer.append(number, XLNumberCodec::format(value.get<double>(), number));    // same text as XLCellValueProxy writes
+                m_buffer += "</v></c>";
+            } break;
+
+            case XLValueType::String: {
+                const std::string text  = value.get<std::string>();
+                const int32_t     index = m_document->sharedStrings().getOrAppendStringByPolicy(text);
+                if (index >= 0) {
+                    m_document->sharedStrings().retainString(index);
+                    m_buffer += " t=\"s\"><v>";
+                    m_buffer += std::to_string(index);
+                    m_buffer += "</v></c>";
+                }
+                else {    // inline string, as the string write policy of the document demands
+                    m_buffer += ((!text.empty()) && (text.front() == ' ' || text.back() == ' ')) ? " t=\"inlineStr\"><is><t xml:space=\"preserve\">"
+                                                                                                 : " t=\"inlineStr\"><is><t>";
+                    appendEscaped(m_buffer, text);
+                    m_buffer += "</t></is></c>";
+                }
+            } break;
+
+            default:    // XLValueType::Error
+                m_buffer += " t=\"e\"><v>";
+                appendEscaped(m_buffer, value.get<std::string>());
+                m_buffer += "</v></c>";
+                break;
+        }
+    }
+
+    m_buffer += "</row>";
+    if (m_buffer.size() >= XLStreamFlushSize) flush();
+}
+
+/**
+ * @details
+ */
+void XLStreamWriter::skipRows(uint32_t count)
+{
+    using namespace std::literals::string_literals;
+
+    if (!m_entry) throw XLInputError("XLStreamWriter::"s + __func__ + ": writer has been closed"s);
+    if (count > MAX_ROWS - m_rowNumber) throw XLInputError("XLStreamWriter::"s + __func__ + ": row number would exceed MAX_ROWS"s);
+    m_rowNumber += count;
+}
+
+/**
+ * @details
+ */
+uint32_t XLStreamWriter::rowNumber() const { return m_rowNumber; }
+
+/**
+ * @details Adds the worksheet to the workbook like XLWorkbook::addWorksheet, then replaces the (empty) worksheet entry created in
+ *  the archive with the streamed entry. The XML data of the new worksheet is not loaded, so the document will not overwrite the
+ *  entry when saving, and will read it from the archive when the worksheet is accessed.
+ */
+void XLStreamWriter::close()
+{
+    if (!m_entry) return;
+
+    m_buffer += XLStreamWorksheetFooter;
+    flush();
+
+    XLWorkbook workbook = m_document->workbook();
+    workbook.addWorksheet(m_sheetName);
+
+    const std::unique_ptr<XLZipEntryWriter> entry = std::move(m_entry);
+    entry->commit(workbook.sheetXmlData(m_sheetName)->getXmlPath());
+}
+
+/**
+ * @details
+ */
+bool XLStreamWriter::isOpen() const { return m_entry != nullptr; }
+
+/**
+ * @details
+ */
+void XLStreamWriter::flush()
+{
+    m_entry->write(m_buffer.data(), m_buffer.size());
+    m_buffer.clear();
+}
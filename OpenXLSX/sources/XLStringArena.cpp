@@ -0,0 +1,445 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+// ===== External Includes ===== //
+#include <charconv>    // std::from_chars
+#include <cstdint>     // uint32_t
+#include <cstring>     // std::memchr, std::memcpy
+#include <utility>     // std::move, std::exchange
+
+// ===== OpenXLSX Includes ===== //
+#include "XLException.hpp"
+#include "XLStringArena.hpp"
+
+using namespace OpenXLSX;
+
+namespace
+{
+    constexpr size_t arenaBlockSize = 64 * 1024;    // strings longer than a quarter block get a memory block of their own
+
+    /**
+     * @brief the kinds of markup distinguished when scanning the shared strings XML
+     */
+    enum class XLTagKind { Start, End, Empty, CData, Other };
+
+    /**
+     * @brief a markup item of the shared strings XML: the element name without namespace prefix (for a CDATA section: its
+     *        content), and the position following the markup
+     */
+    struct XLTag
+    {
+        XLTagKind        kind {XLTagKind::Other};
+        std::string_view name {};
+        const char*      next {nullptr};
+    };
+
+    /**
+     * @brief find the first occurrence of pattern in [pos;end)
+     * @return the position of pattern, or end if not found
+     */
+    const char* findText(const char* pos, const char* end, std::string_view pattern)
+    {
+        const size_t found = std::string_view(pos, static_cast<size_t>(end - pos)).find(pattern);
+        return found == std::string_view::npos ? end : pos + found;
+    }
+
+    /**
+     * @brief find the next '<' in [pos;end)
+     * @return the position of '<', or nullptr if not found
+     */
+    const char* findMarkup(const char* pos, const char* end)
+    {
+        return static_cast<const char*>(std::memchr(pos, '<', static_cast<size_t>(end - pos)));
+    }
+
+    /**
+     * @brief read the markup starting at pos, where *pos == '<'
+     * @return false if the markup is not terminated before end
+     */
+    bool readTag(const char* pos, const char* end, XLTag& tag)
+    {
+        using namespace std::literals::string_view_literals;
+        const std::string_view markup(pos, static_cast<size_t>(end - pos));
+
+        if (markup.substr(0, 9) == "<![CDATA["sv) {
+            const char* close = findText(pos + 9, end, "]]>"sv);
+            if (close == end) return false;
+            tag = { XLTagKind::CData, std::string_view(pos + 9, static_cast<size_t>(close - pos - 9)), close + 3 };
+            return true;
+        }
+        if (markup.substr(0, 4) == "<!--"sv || markup.substr(0, 2) == "<?"sv) {
+            const std::string_view terminator = (markup[1] == '!' ? "-->"sv : "?>"sv);
+            const char* close = findText(pos + 2, end, terminator);
+            if (close == end) return false;
+            tag = { XLTagKind::Other, {}, close + terminator.size() };
+            return true;
+        }
+
+        // ===== Element tag (or DOCTYPE declaration): find the closing '>' outside of quoted attribute values
+        const bool  closing   = (markup.size() > 1 && markup[1] == '/');
+        const char* nameBegin = pos + (closing ? 2 : 1);
+        const char* nameEnd   = nameBegin;
+        while (nameEnd < end && *nameEnd != '>' && *nameEnd != '/' && *nameEnd != ' ' && *nameEnd != '\t' && *nameEnd != '\r' && *nameEnd != '\n')
+            ++nameEnd;
+
+        const char* close = nameEnd;
+        char        quote = 0;
+        for (; close < end; ++close) {
+            if (quote != 0) { if (*close == quote) quote = 0; }
+            else if (*close == '"' || *close == '\'') quote = *close;
+            else if (*close == '>') break;
+        }
+        if (close == end) return false;
+
+        std::string_view name(nameBegin, static_cast<size_t>(nameEnd - nameBegin));
+        if (const size_t colon = name.find(':'); colon != std::string_view::npos) name.remove_prefix(colon + 1);    // ignore namespace prefix
+
+        XLTagKind kind = (closing ? XLTagKind::End : (close[-1] == '/' ? XLTagKind::Empty : XLTagKind::Start));
+        if (nameBegin < end && *nameBegin == '!') kind = XLTagKind::Other;    // DOCTYPE
+        tag = { kind, name, close + 1 };
+        return true;
+    }
+
+    /**
+     * @brief append a code point to a string in UTF-8 encoding
+     */
+    void appendUtf8(std::string& out, uint32_t codePoint)
+    {
+        if (codePoint < 0x80)
+            out += static_cast<char>(codePoint);
+        else if (codePoint < 0x800) {
+            out += static_cast<char>(0xC0 | (codePoint >> 6));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        else if (codePoint < 0x10000) {
+            out += static_cast<char>(0xE0 | (codePoint >> 12));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        else {
+            out += static_cast<char>(0xF0 | (codePoint >> 18));
+            out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    /**
+     * @brief append the character data [pos;end) to out, resolving entity & character references and normalizing line endings
+     *        like pugixml does with parse_escapes | parse_eol - unknown references are kept as they are
+     */
+    void appendText(std::string& out, const char* pos, const char* end)
+    {
+        using namespace std::literals::string_view_literals;
+        while (pos < end) {
+            const char* special = pos;
+            while (special < end && *special != '&' && *special != '\r') ++special;
+            out.append(pos, special);
+            if (special == end) return;
+
+            if (*special == '\r') {    // CR LF and a single CR become LF
+                out += '\n';
+                pos = special + ((special + 1 < end && special[1] == '\n') ? 2 : 1);
+                continue;
+            }
+
+            const char* semicolon = static_cast<const char*>(std::memchr(special, ';', static_cast<size_t>(end - special)));
+            if (semicolon == nullptr) {
+                out.append(special, end);
+                return;
+            }
+            const std::string_view reference(special + 1, static_cast<size_t>(semicolon - special - 1));
+            if (reference == "lt"sv) out += '<';
+            else if (reference == "gt"sv) out += '>';
+            else if (reference == "amp"sv) out += '&';
+            else if (reference == "quot"sv) out += '"';
+            else if (reference == "apos"sv) out += '\'';
+            else if (reference.size() > 1 && reference[0] == '#') {
+                const bool  hex    = (reference[1] == 'x');
+                const char* digits = reference.data() + (hex ? 2 : 1);
+                uint32_t    codePoint {0};
+                const auto  result = std::from_chars(digits, semicolon, codePoint, hex ? 16 : 10);
+                if (result.ec == std::errc() && result.ptr == semicolon && digits != semicolon && codePoint <= 0x10FFFF)
+                    appendUtf8(out, codePoint);
+                else
+                    out.append(special, semicolon + 1);
+            }
+            else
+                out.append(special, semicolon + 1);
+            pos = semicolon + 1;
+        }
+    }
+
+    /**
+     * @brief decode the shared string of the <si> element at pos: the text of its <t> children and of the <t> children of its
+     *        rich text runs <r>, ignoring the phonetic properties <rPh> and <phoneticPr>
+     * @throw XLInputError if the element is malformed or has another child element
+     */
+    void decodeSharedString(const char* pos, const char* end, std::string& out)
+    {
+        using namespace std::literals::string_literals;
+        using namespace std::literals::string_view_literals;
+
+        XLTag tag {};
+        if (not readTag(pos, end, tag)) throw XLInputError("xl/sharedStrings.xml si node is not terminated"s);
+        if (tag.kind == XLTagKind::Empty) return;    // <si/>
+
+        int              depth = 0;    // the nesting level below <si>
+        std::string_view child {};     // the open child element of <si>
+        std::string_view grandChild {};
+        pos = tag.next;
+        while (true) {
+            const char* markup = findMarkup(pos, end);
+            if (markup == nullptr) throw XLInputError("xl/sharedStrings.xml si node is not terminated"s);
+
+            const bool inText = (depth == 1 && child == "t"sv) || (depth == 2 && child == "r"sv && grandChild == "t"sv);
+            if (inText) appendText(out, pos, markup);
+
+            if (not readTag(markup, end, tag)) throw XLInputError("xl/sharedStrings.xml si node is not terminated"s);
+            switch (tag.kind) {
+                case XLTagKind::Start:
+                case XLTagKind::Empty:
+                    if (depth == 0 && tag.name != "t"sv && tag.name != "r"sv && tag.name != "rPh"sv && tag.name != "phoneticPr"sv)
+                        throw XLInputError("xl/sharedStrings.xml si node \""s + std::string(tag.name) + "\" is none of \"r\", \"t\", \"rPh\", \"phoneticPr\""s);
+                    if (tag.kind == XLTagKind::Start) {
+                        ++depth;
+                        if (depth == 1) child = tag.name;
+                        else if (depth == 2) grandChild = tag.name;
+                    }
+                    break;
+                case XLTagKind::End:
+                    if (depth == 0) return;    // </si>
+                    --depth;
+                    break;
+                case XLTagKind::CData:
+                    if (inText) out.append(tag.name);
+                    break;
+                default:
+                    break;
+            }
+            pos = tag.next;
+        }
+    }
+}    // namespace
+
+/**
+ * @details
+ */
+XLStringArena::XLStringArena() = default;
+
+/**
+ * @details The memory blocks are handed over, so that the stored strings keep their address
+ */
+XLStringArena::XLStringArena(XLStringArena&& other) noexcept { *this = std::move(other); }
+
+/**
+ * @details
+ */
+XLStringArena::~XLStringArena() = default;
+
+/**
+ * @details other is left empty - it must not keep writing into the memory blocks it handed over
+ */
+XLStringArena& XLStringArena::operator=(XLStringArena&& other) noexcept
+{
+    if (this != &other) {
+        m_entries    = std::move(other.m_entries);
+        m_blocks     = std::move(other.m_blocks);
+        m_blockPos   = std::exchange(other.m_blockPos, nullptr);
+        m_blockFree  = std::exchange(other.m_blockFree, 0);
+        m_xml        = std::move(other.m_xml);
+        m_xmlOffsets = std::move(other.m_xmlOffsets);
+        m_undecoded  = std::exchange(other.m_undecoded, 0);
+        other.clear();
+    }
+    return *this;
+}
+
+/**
+ * @details
+ */
+std::string_view XLStringArena::view(size_t index) const
+{
+    if (m_entries[index].data == nullptr) decode(index);
+    return std::string_view(m_entries[index].data, m_entries[index].size);
+}
+
+/**
+ * @details
+ */
+size_t XLStringArena::append(std::string_view str)
+{
+    m_entries.push_back({ store(str), str.size() });
+    return m_entries.size() - 1;
+}
+
+/**
+ * @details An undecoded entry does not need to be decoded anymore
+ */
+void XLStringArena::assign(size_t index, std::string_view str)
+{
+    const bool undecoded = (m_entries[index].data == nullptr);
+    m_entries[index]     = { store(str), str.size() };
+    if (undecoded && --m_undecoded == 0) decodeAll();    // releases the XML text
+}
+
+/**
+ * @details
+ */
+void XLStringArena::clear()
+{
+    std::vector<Entry>().swap(m_entries);
+    m_blocks.clear();
+    m_blockPos  = nullptr;
+    m_blockFree = 0;
+    std::string().swap(m_xml);
+    std::vector<size_t>().swap(m_xmlOffsets);
+    m_undecoded = 0;
+}
+
+/**
+ * @details Scan the XML text for the \<si\> child elements of the document element, without decoding them. A document without
+ *          document element (e.g. an empty xl/sharedStrings.xml created by XLDocument) yields an empty table.
+ */
+void XLStringArena::loadXml(std::string xml)
+{
+    using namespace std::literals::string_literals;
+    using namespace std::literals::string_view_literals;
+
+    clear();
+    m_xml             = std::move(xml);
+    const char* begin = m_xml.data();
+    const char* end   = begin + m_xml.size();
+    const char* pos   = begin;
+    XLTag       tag {};
+
+    // ===== Skip the XML declaration, comments etc. up to the document element
+    bool inTable = false;
+    while (not inTable) {
+        const char* markup = findMarkup(pos, end);
+        if (markup == nullptr || not readTag(markup, end, tag) || tag.kind == XLTagKind::Empty || tag.kind == XLTagKind::End) break;
+        inTable = (tag.kind == XLTagKind::Start);
+        pos     = tag.next;
+    }
+
+    // ===== Record the position of each child element, skipping its contents
+    int depth = 0;
+    while (inTable) {
+        const char* markup = findMarkup(pos, end);
+        if (markup == nullptr || not readTag(markup, end, tag)) throw XLInputError("xl/sharedStrings.xml sst node is not terminated"s);
+        switch (tag.kind) {
+            case XLTagKind::Start:
+            case XLTagKind::Empty:
+                if (depth == 0) {    // pull request #186: non-element nodes in sst are skipped
+                    if (tag.name != "si"sv) throw XLInputError("xl/sharedStrings.xml sst node name \""s + std::string(tag.name) + "\" is not \"si\""s);
+                    m_xmlOffsets.push_back(static_cast<size_t>(markup - begin));
+                }
+                if (tag.kind == XLTagKind::Start) ++depth;
+                break;
+            case XLTagKind::End:
+                if (depth == 0) inTable = false;    // </sst>
+                else --depth;
+                break;
+            default:
+                break;
+        }
+        pos = tag.next;
+    }
+
+    m_entries.resize(m_xmlOffsets.size());
+    m_undecoded = m_xmlOffsets.size();
+    if (m_undecoded == 0) decodeAll();    // releases the XML text
+}
+
+/**
+ * @details
+ */
+void XLStringArena::decodeAll() const
+{
+    for (size_t index = 0; m_undecoded > 0 && index < m_xmlOffsets.size(); ++index)
+        if (m_entries[index].data == nullptr) decode(index);
+
+    std::string().swap(m_xml);
+    std::vector<size_t>().swap(m_xmlOffsets);
+}
+
+/**
+ * @details Copy str into the current memory block. Strings never straddle blocks, so the unused tail of a full block is lost.
+ */
+const char* XLStringArena::store(std::string_view str) const
+{
+    if (str.empty()) return "";    // no need to store empty strings
+
+    const size_t required = str.size() + 1;
+    char*        target   = nullptr;
+    if (required > arenaBlockSize / 4) {    // large string: allocate a dedicated block and keep filling the current block
+        m_blocks.emplace_back(new char[required]);
+        target = m_blocks.back().get();
+    }
+    else {
+        if (required > m_blockFree) {
+            m_blocks.emplace_back(new char[arenaBlockSize]);
+            m_blockPos  = m_blocks.back().get();
+            m_blockFree = arenaBlockSize;
+        }
+        target = m_blockPos;
+        m_blockPos += required;
+        m_blockFree -= required;
+    }
+    std::memcpy(target, str.data(), str.size());
+    target[str.size()] = '\0';
+    return target;
+}
+
+/**
+ * @details
+ */
+void XLStringArena::decode(size_t index) const
+{
+    std::string decoded {};
+    decodeSharedString(m_xml.data() + m_xmlOffsets[index], m_xml.data() + m_xml.size(), decoded);
+    m_entries[index] = { store(decoded), decoded.size() };
+    if (--m_undecoded == 0) decodeAll();    // releases the XML text
+}
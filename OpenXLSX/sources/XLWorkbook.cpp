@@ -118,27 +118,7 @@ XLWorkbook& XLWorkbook::operator=(XLWorkbook&& other) = default;
 /**
  * @details
  */
-XLSheet XLWorkbook::sheet(const std::string& sheetName)
-{
-    // ===== First determine if the sheet exists.
-    if (xmlDocument().document_element().child("sheets").find_child_by_attribute("name", sheetName.c_str()) == nullptr)
-        throw XLInputError("Sheet \"" + sheetName + "\" does not exist");
-
-    // ===== Find the sheet data corresponding to the sheet with the requested name
-    const std::string xmlID =
-        xmlDocument().document_element().child("sheets").find_child_by_attribute("name", sheetName.c_str()).attribute("r:id").value();
-
-    XLQuery pathQuery(XLQueryType::QuerySheetRelsTarget);
-    pathQuery.setParam("sheetID", xmlID);
-    auto xmlPath = parentDoc().execQuery(pathQuery).result<std::string>();
-
-    // Some spreadsheets use absolute rather than relative paths in relationship items.
-    if (xmlPath.substr(0, 4) == "/xl/") xmlPath = xmlPath.substr(4);
-
-    XLQuery xmlQuery(XLQueryType::QueryXmlData);
-    xmlQuery.setParam("xmlPath", "xl/" + xmlPath);
-    return XLSheet(parentDoc().execQuery(xmlQuery).result<XLXmlData*>());
-}
+XLSheet XLWorkbook::sheet(const std::string& sheetName) { return XLSheet(sheetXmlData(sheetName)); }
 
 /**
  * @details iterate over sheetsNode and count element nodes until index, get sheet name and return the corresponding sheet object
@@ -184,6 +164,30 @@ XLChartsheet XLWorkbook::chartsheet(const std::string& sheetName) { return sheet
  */
 XLChartsheet XLWorkbook::chartsheet(uint16_t index) { return sheet(index).get<XLChartsheet>(); }
 
+/**
+ * @details The worksheet XML data is only located, not parsed, so that the stream reader can read the sheet directly from the archive
+ */
+XLStreamReader XLWorkbook::streamReader(const std::string& sheetName)
+{
+    if (typeOfSheet(sheetName) != XLSheetType::Worksheet) throw XLInputError("Sheet \"" + sheetName + "\" is not a worksheet");
+    return XLStreamReader(sheetXmlData(sheetName));
+}
+
+/**
+ * @details
+ */
+XLStreamWriter XLWorkbook::streamWriter(const std::string& sheetName)
+{
+    if (sheetExists(sheetName)) throw XLInputError("Sheet named \"" + sheetName + "\" already exists.");
+    parentDoc().validateSheetName(sheetName, true);
+    return XLStreamWriter(&parentDoc(), sheetName);
+}
+
+/**
+ * @details
+ */
+std::shared_future<void> XLWorkbook::prefetch(const std::string& sheetName) { return parentDoc().prefetch(sheetName); }
+
 // /**
 //  * @details
 //  */
@@ -291,6 +295,31 @@ void XLWorkbook::cloneSheet(const std::string& existingName, const std::string&
     parentDoc().execCommand(XLCommand(XLCommandType::CloneSheet).setParam("sheetID", sheetID(existingName)).setParam("cloneName", newName));
 }
 
+/**
+ * @details
+ */
+XLXmlData* XLWorkbook::sheetXmlData(const std::string& sheetName)
+{
+    // ===== First determine if the sheet exists.
+    if (xmlDocument().document_element().child("sheets").find_child_by_attribute("name", sheetName.c_str()) == nullptr)
+        throw XLInputError("Sheet \"" + sheetName + "\" does not exist");
+
+    // ===== Find the sheet data corresponding to the sheet with the requested name
+    const std::string xmlID =
+        xmlDocument().document_element().child("sheets").find_child_by_attribute("name", sheetName.c_str()).attribute("r:id").value();
+
+    XLQuery pathQuery(XLQueryType::QuerySheetRelsTarget);
+    pathQuery.setParam("sheetID", xmlID);
+    auto xmlPath = parentDoc().execQuery(pathQuery).result<std::string>();
+
+    // Some spreadsheets use absolute rather than relative paths in relationship items.
+    if (xmlPath.substr(0, 4) == "/xl/") xmlPath = xmlPath.substr(4);
+
+    XLQuery xmlQuery(XLQueryType::QueryXmlData);
+    xmlQuery.setParam("xmlPath", "xl/" + xmlPath);
+    return parentDoc().execQuery(xmlQuery).result<XLXmlData*>();
+}
+
 /**
  * @details
  */
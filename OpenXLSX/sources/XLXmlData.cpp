@@ -45,9 +45,12 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 // ===== External Includes ===== //
 #include <sstream>
+#include <system_error>    // std::system_error
 
 // ===== OpenXLSX Includes ===== //
 #include "XLDocument.hpp"
+#include "XLRowIndex.hpp"
+#include "XLSheetBounds.hpp"
 #include "XLXmlData.hpp"
 #include "XLXmlParser.hpp"              // pugixml wrapper
 
@@ -140,7 +143,19 @@ XLXmlData& XLXmlData::operator=(XLXmlData&& other) noexcept = default;
  */
 void XLXmlData::setRawData(const std::string& data) // NOLINT
 {
+    if (m_pendingLoad.valid()) {    // a background load must not race with the new data - its result is discarded
+        m_pendingLoad.wait();
+        m_pendingLoad = {};
+    }
     m_xmlDoc->load_string(data.c_str(), pugi_parse_settings);
+    m_dirty         = true;
+    m_xmlSize       = data.size();
+    m_resident      = false;    // account for the new document on next access
+    if (m_rowIndex) m_rowIndex->clear();    // the indexed row nodes no longer exist
+    if (m_sheetBounds) {
+        m_sheetBounds->clear();                         // determined again from the new XML
+        m_sheetBounds->setExplicitDimension(false);     // the new XML replaces a dimension set by the user
+    }
 }
 
 /**
@@ -229,8 +244,9 @@ XLContentType XLXmlData::getXmlType() const
  */
 XMLDocument* XLXmlData::getXmlDocument()
 {
-    if (!m_xmlDoc->document_element())
-        m_xmlDoc->load_string(m_parentDoc->extractXmlFromArchive(m_xmlPath).c_str(), pugi_parse_settings);
+    load();
+    touch();    // before setting m_dirty, see touch
+    m_dirty = true;    // caller may modify the document
 
     return m_xmlDoc.get();
 }
@@ -240,8 +256,120 @@ XMLDocument* XLXmlData::getXmlDocument()
  */
 const XMLDocument* XLXmlData::getXmlDocument() const
 {
-    if (!m_xmlDoc->document_element())
-        m_xmlDoc->load_string(m_parentDoc->extractXmlFromArchive(m_xmlPath).c_str(), pugi_parse_settings);
+    load();
+    touch();    // before setting m_dirty, see touch
+    if (m_xmlType != XLContentType::Worksheet)    // XMLNode handles from a const document still allow modification
+        m_dirty = true;                            // a worksheet records its modifications in m_sheetBounds instead
 
     return m_xmlDoc.get();
 }
+
+/**
+ * @details
+ */
+void XLXmlData::load() const
+{
+    if (m_pendingLoad.valid()) {                           // if a background load was started by loadAsync:
+        const auto pendingLoad = std::move(m_pendingLoad);    // wait for it exactly once (m_pendingLoad becomes invalid)
+        pendingLoad.get();                                  // rethrows an exception from the background load
+    }
+    loadFromArchive();
+}
+
+/**
+ * @details The background thread only touches m_xmlDoc, m_pendingLoad is only accessed by the thread that owns the document.
+ *  If no thread can be started, the XML document is loaded synchronously.
+ */
+std::shared_future<void> XLXmlData::loadAsync()
+{
+    if (m_pendingLoad.valid()) return m_pendingLoad;
+
+    if (!isLoaded()) {
+        try {
+            m_pendingLoad = std::async(std::launch::async, [this]() { loadFromArchive(); }).share();
+            return m_pendingLoad;
+        }
+        catch (const std::system_error&) {
+            loadFromArchive();
+        }
+    }
+    std::promise<void> loaded;
+    loaded.set_value();
+    return loaded.get_future().share();
+}
+
+/**
+ * @details
+ */
+void XLXmlData::loadFromArchive() const
+{
+    if (!isLoaded())
+        m_xmlSize = m_parentDoc->loadXmlFromArchive(m_xmlPath, *m_xmlDoc);    // zero-copy handoff of the inflated data to pugixml
+}
+
+/**
+ * @details Only the thread that owns the document calls touch, so the counters of the parent document need no synchronization.
+ *  The memory budget is enforced when a (re-)loaded worksheet is accessed for the first time.
+ */
+void XLXmlData::touch() const
+{
+    m_lastAccess = ++m_parentDoc->m_accessClock;
+    if (m_resident) return;
+
+    m_resident = true;
+    if (m_evicted) {
+        m_evicted = false;
+        ++m_parentDoc->m_reloadCount;
+    }
+    if (m_parentDoc->m_memoryBudget > 0 && m_xmlType == XLContentType::Worksheet) m_parentDoc->enforceMemoryBudget(this);
+}
+
+/**
+ * @details
+ */
+void XLXmlData::unload()
+{
+    m_xmlDoc->reset();
+    if (m_rowIndex) m_rowIndex->clear();    // the indexed row nodes no longer exist
+    if (m_sheetBounds) m_sheetBounds->clear();    // determined again from the (re)loaded XML
+    m_xmlSize       = 0;
+    m_resident      = false;
+    m_evicted       = true;
+}
+
+/**
+ * @details
+ */
+void XLXmlData::markClean()
+{
+    m_dirty = false;
+    if (m_sheetBounds) m_sheetBounds->clearModified();
+}
+
+/**
+ * @details
+ */
+bool XLXmlData::isDirty() const { return m_dirty || (m_sheetBounds && m_sheetBounds->isModified()); }
+
+/**
+ * @details
+ */
+bool XLXmlData::isLoaded() const { return static_cast<bool>(m_xmlDoc->document_element()); }
+
+/**
+ * @details
+ */
+XLRowIndex& XLXmlData::rowIndex()
+{
+    if (!m_rowIndex) m_rowIndex = std::make_unique<XLRowIndex>();
+    return *m_rowIndex;
+}
+
+/**
+ * @details
+ */
+XLSheetBounds& XLXmlData::sheetBounds()
+{
+    if (!m_sheetBounds) m_sheetBounds = XLSheetBoundsRef(new XLSheetBounds());    // shared with the cells, rows and ranges
+    return *m_sheetBounds;
+}
@@ -139,16 +139,16 @@ std::string XLXmlFile::relationshipID() const
  */
 XMLDocument& XLXmlFile::xmlDocument()
 {
-    return const_cast<XMLDocument&>(static_cast<const XLXmlFile*>(this)->xmlDocument());    // NOLINT
-    // return *m_xmlData->getXmlDocument();    // <- why not this easy version?
+    return *m_xmlData->getXmlDocument();
 }
 
 /**
- * @details This method returns a pointer to the underlying XMLDocument resource as const.
+ * @details This method returns a pointer to the underlying XMLDocument resource as const. Unlike the non-const overload, this
+ *  does not mark a worksheet as dirty, see XLXmlData::getXmlDocument.
  */
 const XMLDocument& XLXmlFile::xmlDocument() const
 {
-    return *m_xmlData->getXmlDocument();
+    return *static_cast<const XLXmlData*>(m_xmlData)->getXmlDocument();
 }
 
 /**
@@ -51,7 +51,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 namespace OpenXLSX
 {
-    bool NO_XML_NS = true; // default: no XML namespaces
+    std::atomic<bool> NO_XML_NS { true }; // default: no XML namespaces
     /**
      * @details this function is meaningless when PUGI_AUGMENTED is not defined / used
      */
@@ -99,7 +99,7 @@ namespace OpenXLSX
      */
     const pugi::char_t* XMLNode::name_without_namespace(const pugi::char_t* name_) const
     {
-        if (NO_XML_NS) return name_;    // if node namespaces are not stripped: return immediately
+        if (NO_XML_NS.load(std::memory_order_relaxed)) return name_;    // if node namespaces are not stripped: return immediately
         int pos = 0;
         while (name_[pos] && name_[pos] != ':') ++pos;    // find namespace delimiter
         if (!name_[pos]) return name_;                    // if no delimiter found: return unmodified name
@@ -107,8 +107,8 @@ namespace OpenXLSX
     }
 
     /**
-     * @details for creation of node children: copy this node's namespace without thread safety, using
-     *  a static character array to avoid smart pointer performance impact
+     * @details for creation of node children: copy this node's namespace into a thread_local character array, which
+     *  avoids the smart pointer performance impact and is safe when several threads create nodes concurrently
      */
     const pugi::char_t* XMLNode::namespaced_name_char(const pugi::char_t* name_, bool force_ns) const
     {
@@ -119,7 +119,7 @@ namespace OpenXLSX
         throw XLException("OpenXLSX_xml_node::"s + __func__ + ": strlen of "s + name_ + " exceeds XLMaxNamespacedNameLen "s + std::to_string(XLMaxNamespacedNameLen));
         }
 
-        static pugi::char_t namespaced_name_[ XLMaxNamespacedNameLen + 1 ]; // static memory allocation for concatenating node namespace and name_
+        thread_local pugi::char_t namespaced_name_[ XLMaxNamespacedNameLen + 1 ]; // per-thread static memory for concatenating node namespace and name_
 
         // ===== If node has a namespace: create a namespaced version of name_
         memcpy(namespaced_name_, xml_node::name(), name_begin);    // copy the node namespace
@@ -128,8 +128,8 @@ namespace OpenXLSX
     }
 
     /**
-     * @details for creation of node children: copy this node's namespace with thread safety, using
-     *  smart pointer with a trade-off for ~15-20% performance impact (increased runtime)
+     * @details for creation of node children: copy the name concatenated by namespaced_name_char into memory owned by the
+     *  returned smart pointer
      * @note // 2024-08-18: made lambda parameter unnamed to eliminate -Wunused-parameter
      */
     std::shared_ptr<pugi::char_t> XMLNode::namespaced_name_shared_ptr(const pugi::char_t* name_, bool force_ns) const
@@ -137,10 +137,11 @@ namespace OpenXLSX
         // ===== If node has no namespace: Early pass-through return with noop-deleter
         if (!name_begin || force_ns) return std::shared_ptr<pugi::char_t>(const_cast<pugi::char_t*>(name_), [](pugi::char_t*){});
 
-        // ===== If node has a namespace: allocate memory for concatenation and create a namespaced version of name_
-        std::shared_ptr<pugi::char_t> namespaced_name_ (new pugi::char_t[name_begin + strlen(name_) + 1], std::default_delete<pugi::char_t[]>());
-        memcpy(namespaced_name_.get(), xml_node::name(), name_begin);    // copy the node namespace
-        strcpy(namespaced_name_.get() + name_begin, name_);          // concatenate the name_ with terminating zero
+        // ===== If node has a namespace: allocate memory for a copy of the namespaced version of name_
+        const pugi::char_t* namespacedName = namespaced_name_char(name_, force_ns);
+        const size_t        length         = strlen(namespacedName) + 1;    // including the terminating zero
+        std::shared_ptr<pugi::char_t> namespaced_name_ (new pugi::char_t[length], std::default_delete<pugi::char_t[]>());
+        memcpy(namespaced_name_.get(), namespacedName, length);
         return namespaced_name_;
     }
 
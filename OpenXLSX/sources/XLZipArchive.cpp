@@ -44,6 +44,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
  */
 
 // ===== External Includes ===== //
+#include <mutex>    // std::mutex, std::unique_lock
 #include <string>   // std::string
 
 #ifdef USE_LIBZIP
@@ -79,18 +80,27 @@ using namespace OpenXLSX;
  */
 XLZipArchive::XLZipArchive() : m_archive(nullptr) {}
 
+/**
+ * @details
+ */
+XLZipArchive::XLZipArchive(XLZipOpenMode openMode) : m_archive(nullptr), m_openMode(openMode) {}
+
 /**
  * @details CAUTION: shallow copy (explicit default constructor)
  */
 XLZipArchive::XLZipArchive(const XLZipArchive& other)
- : m_archive(other.m_archive)
+ : m_archive(other.m_archive),
+   m_mutex(other.m_mutex),
+   m_openMode(other.m_openMode)
 {}
 
 /**
  * @details
  */
 XLZipArchive::XLZipArchive(XLZipArchive&& other) noexcept
- : m_archive(std::move(other.m_archive))
+ : m_archive(std::move(other.m_archive)),
+   m_mutex(std::move(other.m_mutex)),
+   m_openMode(other.m_openMode)
 {}
 
 /**
@@ -112,7 +122,9 @@ XLZipArchive::~XLZipArchive() = default;
  */
 XLZipArchive& XLZipArchive::operator=(XLZipArchive&& other) noexcept
 {
-    m_archive = std::move(other.m_archive);
+    m_archive  = std::move(other.m_archive);
+    m_mutex    = std::move(other.m_mutex);
+    m_openMode = other.m_openMode;
 	 return *this;
 }
 
@@ -153,11 +165,13 @@ void XLZipArchive::open(const std::string& fileName)
 {
     if (isOpen()) throw XLInputError("XLZipArchive::open: archive is already open"); // prevent double open
     m_archive = std::make_shared<XLZipImplementation>();
+    m_mutex   = std::make_shared<std::mutex>();
     try {
-        m_archive->Open(fileName);
+        m_archive->Open(fileName, m_openMode == XLZipOpenMode::MemoryMapped);
     }
     catch( ... ) {    // catch all exceptions
         m_archive.reset();    // make m_archive invalid again
+        m_mutex.reset();
         throw;                // re-throw
     }
 }
@@ -168,8 +182,12 @@ void XLZipArchive::open(const std::string& fileName)
 void XLZipArchive::close()
 {
     if (!m_archive) throw XLInputError("XLZipArchive::close: archive is not open"); // prevent SEGFAULT
-    m_archive->Close();
+    {
+        const auto lock = lockArchive();
+        m_archive->Close();
+    }
     m_archive.reset();
+    m_mutex.reset();
 }
 
 /**
@@ -179,6 +197,7 @@ void XLZipArchive::commitChanges()
 {
     if (!m_archive) throw XLInputError("XLZipArchive::commitChanges: archive is not open"); // prevent SEGFAULT
 #ifdef USE_LIBZIP
+    const auto lock = lockArchive();
     m_archive->CommitChanges(); // libzip needs a zip archive close & reopen
 #else
     // no-op for zippy
@@ -188,10 +207,11 @@ void XLZipArchive::commitChanges()
 /**
  * @details
  */
-void XLZipArchive::save(const std::string& path) // NOLINT
+void XLZipArchive::save(const std::string& path, unsigned int compressionThreads) // NOLINT
 {
     if (!m_archive) throw XLInputError("XLZipArchive::save: archive is not open"); // prevent SEGFAULT
-    m_archive->Save(path);
+    const auto lock = lockArchive();
+    m_archive->Save(path, compressionThreads);
 }
 
 /**
@@ -200,6 +220,7 @@ void XLZipArchive::save(const std::string& path) // NOLINT
 void XLZipArchive::addEntry(const std::string& name, const std::string& data) // NOLINT
 {
     if (!m_archive) throw XLInputError("XLZipArchive::addEntry: archive is not open"); // prevent SEGFAULT
+    const auto lock = lockArchive();
     m_archive->AddEntry(name, data);
 }
 
@@ -218,6 +239,7 @@ void XLZipArchive::addEntryAndCommit(const std::string& name, const std::string&
 void XLZipArchive::deleteEntry(const std::string& entryName) // NOLINT
 {
     if (!m_archive) throw XLInputError("XLZipArchive::deleteEntry: archive is not open"); // prevent SEGFAULT
+    const auto lock = lockArchive();
     m_archive->DeleteEntry(entryName);
 }
 
@@ -226,6 +248,7 @@ void XLZipArchive::deleteEntry(const std::string& entryName) // NOLINT
  */
 std::string XLZipArchive::getEntry(const std::string& name) const {
     if (!m_archive) throw XLInputError("XLZipArchive::getEntry: archive is not open"); // prevent SEGFAULT
+    const auto lock = lockArchive();
 #ifdef USE_LIBZIP
     return m_archive->GetEntryDataAsString(name);
 #else
@@ -233,11 +256,123 @@ std::string XLZipArchive::getEntry(const std::string& name) const {
 #endif
 }
 
+/**
+ * @details
+ */
+void* XLZipArchive::getEntryBuffer(const std::string& name, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*)) const {
+    if (!m_archive) throw XLInputError("XLZipArchive::getEntryBuffer: archive is not open"); // prevent SEGFAULT
+#ifdef USE_LIBZIP
+    const auto lock = lockArchive();
+    return m_archive->GetEntryDataToBuffer(name, size, allocate, deallocate);
+#else
+    // ===== miniz extracts from the in-memory archive without shared decompression state, concurrent calls are safe
+    return m_archive->GetEntryBuffer(name, size, allocate, deallocate);
+#endif
+}
+
+namespace
+{
+    /**
+     * @brief XLZipEntryStream implementation on top of the entry reader of the zip library in use
+     */
+    class XLZipArchiveEntryStream : public XLZipEntryStream
+    {
+    public:
+        /**
+         * @brief open the reader while holding lock, which is released before the stream is handed out
+         */
+        XLZipArchiveEntryStream(std::shared_ptr<XLZipImplementation> archive,
+                                std::shared_ptr<std::mutex>          mutex,
+                                const std::string&                   name,
+                                std::unique_lock<std::mutex>         lock)
+            : m_archive(std::move(archive)),
+              m_mutex(std::move(mutex)),
+              m_reader(m_archive->OpenEntryReader(name))
+        {
+            if (lock.owns_lock()) lock.unlock();
+        }
+
+#ifdef USE_LIBZIP
+        ~XLZipArchiveEntryStream() override
+        {
+            const std::lock_guard<std::mutex> lock(*m_mutex);
+            LibZip::ZipEntryReader closing(std::move(m_reader));    // close the libzip file handle while holding the lock
+        }
+
+        size_t read(char* buffer, size_t size) override
+        {
+            const std::lock_guard<std::mutex> lock(*m_mutex);
+            return m_reader.Read(buffer, size);
+        }
+#else
+        size_t read(char* buffer, size_t size) override { return m_reader.Read(buffer, size); }
+#endif
+
+    private:
+        std::shared_ptr<XLZipImplementation> m_archive; /**< keeps the archive object alive while the entry is read */
+        std::shared_ptr<std::mutex>          m_mutex;   /**< the lock of the archive, taken for each libzip call */
+#ifdef USE_LIBZIP
+        LibZip::ZipEntryReader m_reader;
+#else
+        Zippy::ZipEntryReader m_reader;
+#endif
+    };
+
+    /**
+     * @brief XLZipEntryWriter implementation on top of the entry writer of the zip library in use
+     */
+    class XLZipArchiveEntryWriter : public XLZipEntryWriter
+    {
+    public:
+        XLZipArchiveEntryWriter(std::shared_ptr<XLZipImplementation> archive, std::shared_ptr<std::mutex> mutex)
+            : m_archive(std::move(archive)),
+              m_mutex(std::move(mutex)),
+              m_writer(m_archive->OpenEntryWriter())
+        {}
+
+        void write(const char* data, size_t size) override { m_writer.Write(data, size); }
+
+        void commit(const std::string& name) override
+        {
+#ifdef USE_LIBZIP
+            const std::lock_guard<std::mutex> lock(*m_mutex);
+#endif
+            m_archive->CommitEntryWriter(name, m_writer);
+        }
+
+    private:
+        std::shared_ptr<XLZipImplementation> m_archive; /**< keeps the archive object alive while the entry is written */
+        std::shared_ptr<std::mutex>          m_mutex;   /**< the lock of the archive, taken when the entry is committed */
+#ifdef USE_LIBZIP
+        LibZip::ZipEntryWriter m_writer;
+#else
+        Zippy::ZipEntryWriter m_writer;
+#endif
+    };
+}    // namespace
+
+/**
+ * @details
+ */
+std::unique_ptr<XLZipEntryStream> XLZipArchive::openEntryStream(const std::string& name) const {
+    if (!m_archive) throw XLInputError("XLZipArchive::openEntryStream: archive is not open"); // prevent SEGFAULT
+    return std::make_unique<XLZipArchiveEntryStream>(m_archive, m_mutex, name, lockArchive());
+}
+
+/**
+ * @details
+ */
+std::unique_ptr<XLZipEntryWriter> XLZipArchive::openEntryWriter() const {
+    if (!m_archive) throw XLInputError("XLZipArchive::openEntryWriter: archive is not open"); // prevent SEGFAULT
+    return std::make_unique<XLZipArchiveEntryWriter>(m_archive, m_mutex);
+}
+
 /**
  * @details
  */
 bool XLZipArchive::hasEntry(const std::string& entryName) const {
     if (!m_archive) throw XLInputError("XLZipArchive::hasEntry: archive is not open"); // prevent SEGFAULT
+    const auto lock = lockArchive();
     return m_archive->HasEntry(entryName);
 }
 
@@ -247,6 +382,7 @@ bool XLZipArchive::hasEntry(const std::string& entryName) const {
 ssize_t XLZipArchive::entryCount() const
 {
 #ifdef USE_LIBZIP
+    const auto lock = lockArchive();
     return m_archive->EntryCount();
 #else
     return 0; // TODO: can Zippy support this?
@@ -259,8 +395,23 @@ ssize_t XLZipArchive::entryCount() const
 std::string XLZipArchive::entryName( int index ) const
 {
 #ifdef USE_LIBZIP
+    const auto lock = lockArchive();
     return m_archive->EntryName(index);
 #else
     return ""; // TODO: can Zippy support this?
 #endif
 }
+
+/**
+ * @details A libzip archive handle must not be used by several threads at once. The lock belongs to the archive, so that
+ *  reads from unrelated documents do not wait for each other. miniz extracts from the in-memory archive without shared
+ *  decompression state, so zippy needs no lock.
+ */
+std::unique_lock<std::mutex> XLZipArchive::lockArchive() const
+{
+#ifdef USE_LIBZIP
+    return std::unique_lock<std::mutex>(*m_mutex);
+#else
+    return std::unique_lock<std::mutex>();
+#endif
+}
@@ -250,6 +250,23 @@ namespace OpenXLSX
             cellNode.append_attribute("s").set_value(cellStyle);
     }
 
+    /**
+     * @brief Get the column number of a cell node from its "r" attribute without constructing an XLCellReference
+     * @param cellNode the cell node
+     * @return the column number
+     * @throw XLInputError if the "r" attribute is missing or not a valid cell reference, like the XLCellReference constructor
+     */
+    inline uint16_t getCellColumn(const XMLNode& cellNode)
+    {
+        const char*    address = cellNode.attribute("r").value();
+        const uint16_t column  = XLCellReference::columnFromAddress(address);
+        if (column == 0) {
+            using namespace std::literals::string_literals;
+            throw XLInputError("getCellColumn - address \""s + address + "\" is invalid"s);
+        }
+        return column;
+    }
+
     /**
      * @brief Retrieve the xml node representing the cell at the given row and column. If the node doesn't
      * exist, it will be created.
@@ -271,25 +288,25 @@ namespace OpenXLSX
 
         XMLNode cellNode = rowNode.last_child_of_type(pugi::node_element);
         if (!rowNumber) rowNumber = rowNode.attribute("r").as_uint(); // if not provided, determine from rowNode
-        auto cellRef  = XLCellReference(rowNumber, columnNumber);
+        const auto cellRef = [&]() { return XLCellReference(rowNumber, columnNumber).address(); };    // only needed when a cell is created
 
         // ===== If there are no cells in the current row, or the requested cell is beyond the last cell in the row...
-        if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)) {
+        if (cellNode.empty() || (getCellColumn(cellNode) < columnNumber)) {
             // ===== append a new node to the end.
             cellNode = rowNode.append_child("c");
-            setDefaultCellAttributes(cellNode, cellRef.address(), rowNode, columnNumber, colStyles);
+            setDefaultCellAttributes(cellNode, cellRef(), rowNode, columnNumber, colStyles);
         }
         // ===== If the requested node is closest to the end, start from the end and search backwards...
-        else if (XLCellReference(cellNode.attribute("r").value()).column() - columnNumber < columnNumber) {
-            while (not cellNode.empty() && (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber))
+        else if (getCellColumn(cellNode) - columnNumber < columnNumber) {
+            while (not cellNode.empty() && (getCellColumn(cellNode) > columnNumber))
                 cellNode = cellNode.previous_sibling_of_type(pugi::node_element);
             // ===== If the backwards search failed to locate the requested cell
-            if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)) {
+            if (cellNode.empty() || (getCellColumn(cellNode) < columnNumber)) {
                 if (cellNode.empty()) // If between row begin and higher column number, only non-element nodes exist
                     cellNode = rowNode.prepend_child("c"); // insert a new cell node at row begin. When saving, this will keep whitespace formatting towards next cell node
                 else
                     cellNode = rowNode.insert_child_after("c", cellNode);
-                setDefaultCellAttributes(cellNode, cellRef.address(), rowNode, columnNumber, colStyles);
+                setDefaultCellAttributes(cellNode, cellRef(), rowNode, columnNumber, colStyles);
             }
         }
         // ===== Otherwise, start from the beginning
@@ -298,12 +315,12 @@ namespace OpenXLSX
             cellNode = rowNode.first_child_of_type(pugi::node_element);
 
             // ===== It has been verified above that the requested columnNumber is <= the column number of the last node_element, therefore this loop will halt:
-            while (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)
+            while (getCellColumn(cellNode) < columnNumber)
                 cellNode = cellNode.next_sibling_of_type(pugi::node_element);
             // ===== If the forwards search failed to locate the requested cell
-            if (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber) {
+            if (getCellColumn(cellNode) > columnNumber) {
                 cellNode = rowNode.insert_child_before("c", cellNode);
-                setDefaultCellAttributes(cellNode, cellRef.address(), rowNode, columnNumber, colStyles);
+                setDefaultCellAttributes(cellNode, cellRef(), rowNode, columnNumber, colStyles);
             }
         }
         return cellNode;
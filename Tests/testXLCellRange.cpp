@@ -177,4 +177,38 @@ TEST_CASE("XLCellRange Tests", "[XLCellRange]")
 
     }
 
-}
\ No newline at end of file
+    SECTION("XLExistingCellIterator")
+    {
+        for (auto address : { "A1", "C3", "E3", "B5", "XFD1048576" }) wks.cell(address).value() = address;
+
+        std::vector<std::string> visited;
+        auto sheetRange = wks.range(XLCellReference("A1"), XLCellReference("XFD1048576"));
+        for (auto& cell : sheetRange.existingCells()) visited.push_back(cell.value().get<std::string>());
+        REQUIRE(visited == std::vector<std::string> { "A1", "C3", "E3", "B5", "XFD1048576" });
+
+        auto inner = wks.range(XLCellReference("B2"), XLCellReference("D5")).existingCells();
+        auto it    = inner.begin();
+        REQUIRE(it.cellReference().address() == "C3");
+        REQUIRE(it->value().get<std::string>() == "C3");
+        ++it;
+        REQUIRE(it.row() == 5);
+        REQUIRE(it.column() == 2);
+        it++;
+        REQUIRE(it == inner.end());
+        REQUIRE(it.endReached());
+        REQUIRE_THROWS_AS(++it, XLInputError);
+
+        // ===== A range starting at an existing row, and one starting below all rows but the last
+        visited.clear();
+        for (auto& cell : wks.range(XLCellReference("B5"), XLCellReference("XFD1048576")).existingCells())
+            visited.push_back(cell.value().get<std::string>());
+        REQUIRE(visited == std::vector<std::string> { "B5", "XFD1048576" });
+        auto last = wks.range(XLCellReference("A6"), XLCellReference("XFD1048576")).existingCells();
+        REQUIRE(last.begin().cellReference().address() == "XFD1048576");
+
+        // ===== Iterating over holes must not create rows or cells
+        auto empty = wks.range(XLCellReference("A2"), XLCellReference("B4")).existingCells();
+        REQUIRE(empty.begin() == empty.end());
+        REQUIRE(wks.findCell("A2").empty());
+    }
+}
@@ -157,4 +157,32 @@ TEST_CASE("XLCellReference Tests", "[XLCell]")
         REQUIRE(ref3 >= ref1);
         REQUIRE_FALSE(ref1 >= ref3);
     }
+
+    SECTION("Decoding addresses") {
+        REQUIRE(XLCellReference::columnFromAddress("A1") == 1);
+        REQUIRE(XLCellReference::columnFromAddress("Z10") == 26);
+        REQUIRE(XLCellReference::columnFromAddress("AA10") == 27);
+        REQUIRE(XLCellReference::columnFromAddress("XFD1048576") == MAX_COLS);
+        REQUIRE(XLCellReference::rowFromAddress("A1") == 1);
+        REQUIRE(XLCellReference::rowFromAddress("ZZ100") == 100);
+        REQUIRE(XLCellReference::rowFromAddress("XFD1048576") == MAX_ROWS);
+
+        for (const char* address : {"B7", "AB123", "XEZ99999"}) {
+            const XLCellReference ref(address);
+            REQUIRE(XLCellReference::columnFromAddress(address) == ref.column());
+            REQUIRE(XLCellReference::rowFromAddress(address) == ref.row());
+        }
+
+        // ===== Invalid addresses decode to 0
+        REQUIRE(XLCellReference::columnFromAddress("") == 0);
+        REQUIRE(XLCellReference::columnFromAddress("a1") == 0);
+        REQUIRE(XLCellReference::columnFromAddress("11") == 0);
+        REQUIRE(XLCellReference::columnFromAddress("XFE1") == 0);
+        REQUIRE(XLCellReference::columnFromAddress("AAAA1") == 0);
+        REQUIRE(XLCellReference::rowFromAddress("A") == 0);
+        REQUIRE(XLCellReference::rowFromAddress("A0") == 0);
+        REQUIRE(XLCellReference::rowFromAddress("A1x") == 0);
+        REQUIRE(XLCellReference::rowFromAddress("A1048577") == 0);
+        REQUIRE(XLCellReference::rowFromAddress("A12345678") == 0);
+    }
 }
\ No newline at end of file
@@ -4,7 +4,9 @@
 
 #include <OpenXLSX.hpp>
 #include <catch.hpp>
+#include <cstring>
 #include <fstream>
+#include <limits>
 
 using namespace OpenXLSX;
 
@@ -252,4 +254,190 @@ TEST_CASE("XLCellValueProxy Tests", "[XLCellValue]")
         REQUIRE_THROWS(wks.cell("A2").value().get<bool>());
 
     }
+
+    SECTION("XLCellValueProxy shared string reuse")
+    {
+        XLDocument doc;
+        doc.create("./testXLCellValueProxy.xlsx");
+        XLWorksheet wks = doc.workbook().sheet(1);
+        const XLSharedStrings& sst = doc.sharedStrings();
+
+        const int32_t initialCount = sst.stringCount();
+        wks.cell("A1").value() = "Shared";
+        wks.cell("A2").value() = "Shared";
+        wks.cell("A3").value() = "Other";
+        REQUIRE(sst.stringCount() == initialCount + 2);
+        REQUIRE(sst.getStringIndex("Shared") == initialCount);
+        REQUIRE(sst.getStringIndex("Other") == initialCount + 1);
+        REQUIRE(sst.getStringIndex("Missing") == -1);
+        REQUIRE(sst.getOrAppendString("Other") == initialCount + 1);
+        REQUIRE(sst.stringCount() == initialCount + 2);
+
+        sst.clearString(sst.getStringIndex("Other"));
+        REQUIRE_FALSE(sst.stringExists("Other"));
+        wks.cell("A4").value() = "Other";
+        REQUIRE(wks.cell("A4").value().get<std::string>() == "Other");
+        REQUIRE(sst.stringCount() == initialCount + 3);
+
+        // ===== Clearing one of two equal strings keeps the other one findable
+        const int32_t first  = sst.appendString("Twice");
+        const int32_t second = sst.appendString("Twice");
+        REQUIRE(sst.getStringIndex("Twice") == first);
+        sst.clearString(first);
+        REQUIRE(sst.getStringIndex("Twice") == second);
+        REQUIRE(sst.getOrAppendString("Twice") == second);
+        REQUIRE(sst.stringCount() == initialCount + 5);
+    }
+
+    SECTION("XLCellValueProxy string write policies")
+    {
+        XLDocument doc;
+        doc.create("./testXLCellValueProxy.xlsx");
+        XLWorksheet wks = doc.workbook().sheet(1);
+        const XLSharedStrings& sst = doc.sharedStrings();
+        const int32_t initialCount = sst.stringCount();
+
+        // ===== Per call: inline, and shared regardless of the (default) policy
+        wks.cell("A1").value().setInlineString(" inline ");
+        REQUIRE(wks.cell("A1").value().type() == XLValueType::String);
+        REQUIRE(wks.cell("A1").value().get<std::string>() == " inline ");
+        REQUIRE(sst.stringCount() == initialCount);
+        wks.cell("A1").value().setSharedString("shared");
+        REQUIRE(wks.cell("A1").value().get<std::string>() == "shared");
+        REQUIRE(sst.stringCount() == initialCount + 1);
+
+        // ===== Per document: all strings inline
+        XLStringWritePolicy policy;
+        policy.mode = XLStringWriteMode::InlineStrings;
+        doc.setStringWritePolicy(policy);
+        wks.cell("A2").value() = "shared";
+        wks.cell("A3").value() = std::string("not shared");
+        REQUIRE(wks.cell("A2").value().get<std::string>() == "shared");
+        REQUIRE(wks.cell("A3").value().get<std::string>() == "not shared");
+        REQUIRE(sst.stringCount() == initialCount + 1);
+
+        // ===== Adaptive: existing strings are reused, long strings and strings beyond the cardinality threshold are inline
+        policy.mode             = XLStringWriteMode::Adaptive;
+        policy.inlineMinLength  = 10;
+        policy.maxSharedStrings = static_cast<size_t>(initialCount) + 2;
+        doc.setStringWritePolicy(policy);
+        wks.cell("B1").value() = "shared";
+        wks.cell("B2").value() = "a long free text";
+        wks.cell("B3").value() = "short";
+        wks.cell("B4").value() = "short2";
+        REQUIRE(sst.stringCount() == initialCount + 2);
+        REQUIRE(sst.stringExists("short"));
+        REQUIRE_FALSE(sst.stringExists("a long free text"));
+        REQUIRE_FALSE(sst.stringExists("short2"));
+        REQUIRE(wks.cell("B2").value().get<std::string>() == "a long free text");
+        REQUIRE(wks.cell("B4").value().get<std::string>() == "short2");
+
+        // ===== Inline strings survive saving & reopening, and shared strings cleanup
+        doc.cleanupSharedStrings();
+        doc.save();
+        doc.close();
+        doc.open("./testXLCellValueProxy.xlsx");
+        wks = doc.workbook().sheet(1);
+        REQUIRE(wks.cell("A2").value().get<std::string>() == "shared");
+        REQUIRE(wks.cell("A3").value().get<std::string>() == "not shared");
+        REQUIRE(wks.cell("B2").value().get<std::string>() == "a long free text");
+        REQUIRE(wks.cell("B3").value().get<std::string>() == "short");
+        doc.close();
+    }
+
+    SECTION("XLCellValueProxy shared string reference counts")
+    {
+        XLDocument doc;
+        doc.create("./testXLCellValueProxy.xlsx");
+        XLWorksheet wks = doc.workbook().sheet(1);
+        const XLSharedStrings& sst = doc.sharedStrings();
+
+        wks.cell("A1").value() = "keep";
+        wks.cell("A2").value() = "drop";
+        wks.cell("A3").value() = "drop";
+        const int32_t keepIndex = sst.getStringIndex("keep");
+        const int32_t dropIndex = sst.getStringIndex("drop");
+        const int32_t count     = sst.stringCount();
+        REQUIRE(sst.referenceCount(keepIndex) == 1);
+        REQUIRE(sst.referenceCount(dropIndex) == 2);
+
+        // ===== Overwriting, copying and clearing values adjusts the counts
+        wks.cell("A2").value() = 42;
+        REQUIRE(sst.referenceCount(dropIndex) == 1);
+        wks.cell("B1") = wks.cell("A1");
+        REQUIRE(sst.referenceCount(keepIndex) == 2);
+        wks.cell("A3").value().clear();
+        REQUIRE(sst.referenceCount(dropIndex) == 0);
+
+        // ===== Unreferenced strings are released on save, the indices of the other strings do not change
+        doc.save();
+        REQUIRE(sst.stringCount() == count - 1);
+        REQUIRE_FALSE(sst.stringExists("drop"));
+        REQUIRE(sst.getStringIndex("keep") == keepIndex);
+        doc.close();
+
+        doc.open("./testXLCellValueProxy.xlsx");
+        wks = doc.workbook().sheet(1);
+        REQUIRE(wks.cell("A1").value().get<std::string>() == "keep");
+        REQUIRE(wks.cell("B1").value().get<std::string>() == "keep");
+        REQUIRE(wks.cell("A2").value().get<int>() == 42);
+        REQUIRE(doc.sharedStrings().referenceCount(keepIndex) == XLUnknownReferenceCount);
+        doc.close();
+    }
+
+    SECTION("XLCellValueProxy number round trip")
+    {
+        // ===== The codec writes the shortest text that reads back to the identical value, and reading that text writes it again
+        const std::vector<double> doubles { 3.14, 0.1, 0.30000000000000004, -2.5e-308, 1.7976931348623157e308, 1e-05, 1e+20, 123456.789 };
+        char text[XLMaxNumberChars];
+        for (const double d : doubles) {
+            XLNumberCodec::format(d, text);
+            const double parsed = XLNumberCodec::parseDouble(text);
+            REQUIRE(std::memcmp(&parsed, &d, sizeof(double)) == 0);
+            char again[XLMaxNumberChars];
+            XLNumberCodec::format(parsed, again);
+            REQUIRE(std::string(again) == text);
+        }
+        XLNumberCodec::format(3.14, text);
+        REQUIRE(std::string(text) == "3.14");
+        XLNumberCodec::format(1000000.0, text);
+        REQUIRE(std::string(text) == "1000000");
+        XLNumberCodec::format(int64_t { -9223372036854775807 - 1 }, text);
+        REQUIRE(std::string(text) == "-9223372036854775808");
+        REQUIRE(XLNumberCodec::parseInteger(" +42") == 42);
+        REQUIRE(XLNumberCodec::parseInteger("99999999999999999999") == (std::numeric_limits<int64_t>::max)());
+        REQUIRE(XLNumberCodec::parseDouble("not a number") == 0.0);
+        REQUIRE(XLNumberCodec::isFloatingPoint("1e+20"));
+        REQUIRE_FALSE(XLNumberCodec::isFloatingPoint("100"));
+
+        // ===== Cell values survive saving & reopening unchanged, in the cells and the stream writer
+        XLDocument doc;
+        doc.create("./testXLCellValueProxy.xlsx");
+        XLWorksheet wks = doc.workbook().sheet(1);
+        for (size_t i = 0; i < doubles.size(); ++i) wks.cell(static_cast<uint32_t>(i + 1), 1).value() = doubles[i];
+        wks.cell("B1").value() = int64_t { -9223372036854775807 - 1 };
+        {
+            auto writer = doc.workbook().streamWriter("Stream");
+            writer.appendRow(std::vector<XLCellValue>(doubles.begin(), doubles.end()));
+            writer.close();
+        }
+        doc.save();
+        doc.close();
+
+        doc.open("./testXLCellValueProxy.xlsx");
+        wks = doc.workbook().sheet(1);
+        for (size_t i = 0; i < doubles.size(); ++i) {
+            const double d = wks.cell(static_cast<uint32_t>(i + 1), 1).value().get<double>();
+            REQUIRE(std::memcmp(&d, &doubles[i], sizeof(double)) == 0);
+        }
+        REQUIRE(wks.cell("A1").value().type() == XLValueType::Float);
+        REQUIRE(wks.cell("A7").value().type() == XLValueType::Float);    // 1e+20 has no decimal point
+        REQUIRE(wks.cell("B1").value().get<int64_t>() == (std::numeric_limits<int64_t>::min)());
+        auto stream = doc.workbook().worksheet("Stream");
+        for (size_t i = 0; i < doubles.size(); ++i) {
+            const double d = stream.cell(1, static_cast<uint16_t>(i + 1)).value().get<double>();
+            REQUIRE(std::memcmp(&d, &doubles[i], sizeof(double)) == 0);
+        }
+        doc.close();
+    }
 }
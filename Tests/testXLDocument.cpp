@@ -5,9 +5,53 @@
 #include <OpenXLSX.hpp>
 #include <catch.hpp>
 #include <fstream>
+#include <thread>
+#include <vector>
 
 using namespace OpenXLSX;
 
+namespace
+{
+    /**
+     * @brief create a document whose shared strings table holds a plain string (index 0, cell A1) and a rich text string with
+     *  a phonetic run (index 1, cell A2), as written by Excel
+     */
+    void createRichTextDocument(const std::string& path)
+    {
+        {
+            XLDocument doc;
+            doc.create(path, XLForceOverwrite);
+            doc.workbook().worksheet("Sheet1").cell("A1").value() = "plain";
+            doc.workbook().worksheet("Sheet1").cell("A2").value() = "rich";
+            doc.save();
+            doc.close();
+        }
+
+        XLZipArchive archive;
+        archive.open(path);
+        archive.addEntry("xl/sharedStrings.xml",
+                         "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+                         "<sst xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\" count=\"2\" uniqueCount=\"2\">"
+                         "<si><t>plain</t></si>"
+                         "<si><r><rPr><b/></rPr><t>ri</t></r><r><t>ch</t></r><rPh sb=\"0\" eb=\"1\"><t>R</t></rPh><phoneticPr fontId=\"1\"/></si>"
+                         "</sst>");
+        archive.save();
+        archive.close();
+    }
+
+    /**
+     * @brief read the raw XML of an archive entry
+     */
+    std::string readEntry(const std::string& path, const std::string& entryName)
+    {
+        XLZipArchive archive;
+        archive.open(path);
+        std::string xml = archive.getEntry(entryName);
+        archive.close();
+        return xml;
+    }
+}    // namespace
+
 /**
  * @brief The purpose of this test case is to test the creation of XLDocument objects. Each section section
  * tests document creation using a different method. In addition, saving, closing and copying is tested.
@@ -194,4 +238,651 @@ TEST_CASE("XLDocument Tests", "[XLDocument]")
     //        const XLDocument doc(file);
     //        REQUIRE(doc.name() == file);
     //    }
+
+    /**
+     * @test Save a document with several modified entries using parallel compression, then re-open it.
+     */
+    SECTION("Save with parallel compression")
+    {
+        XLDocument doc;
+        doc.create(newfile, XLForceOverwrite);
+        doc.workbook().addWorksheet("Sheet2");
+        doc.workbook().addWorksheet("Sheet3");
+        doc.workbook().worksheet("Sheet1").cell("A1").value() = "Parallel";
+        doc.workbook().worksheet("Sheet2").cell("B2").value() = 42;
+        doc.workbook().worksheet("Sheet3").cell("C3").value() = 3.5;
+        doc.save(4);
+        doc.close();
+
+        doc.open(newfile);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<std::string>() == "Parallel");
+        REQUIRE(doc.workbook().worksheet("Sheet2").cell("B2").value().get<int>() == 42);
+        REQUIRE(doc.workbook().worksheet("Sheet3").cell("C3").value().get<double>() == 3.5);
+        doc.saveAs(file, XLForceOverwrite, XLAutoCompressionThreads);
+        doc.close();
+
+        doc.open(file);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<std::string>() == "Parallel");
+        REQUIRE(doc.workbook().worksheet("Sheet2").cell("B2").value().get<int>() == 42);
+        REQUIRE(doc.workbook().worksheet("Sheet3").cell("C3").value().get<double>() == 3.5);
+        doc.close();
+    }
+
+    /**
+     * @test Save a document in which one worksheet was never accessed: the untouched part must survive unchanged.
+     */
+    SECTION("Save with untouched parts")
+    {
+        XLDocument doc;
+        doc.create(newfile, XLForceOverwrite);
+        doc.workbook().addWorksheet("Untouched");
+        doc.workbook().worksheet("Untouched").cell("A1").value() = "keep me";
+        doc.save();
+        doc.close();
+
+        doc.open(newfile);
+        doc.workbook().worksheet("Sheet1").cell("A1").value() = "changed";
+        doc.save();
+        doc.close();
+
+        doc.open(newfile);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<std::string>() == "changed");
+        REQUIRE(doc.workbook().worksheet("Untouched").cell("A1").value().get<std::string>() == "keep me");
+        doc.close();
+    }
+
+    /**
+     * @test Open, modify and save a document with a memory-mapped archive.
+     */
+    SECTION("Open memory-mapped archive")
+    {
+        {
+            XLDocument doc;
+            doc.create(newfile, XLForceOverwrite);
+            doc.workbook().worksheet("Sheet1").cell("A1").value() = "mapped";
+            doc.save();
+            doc.close();
+        }
+
+        XLDocument doc(XLZipArchive(XLZipOpenMode::MemoryMapped));
+        doc.open(newfile);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<std::string>() == "mapped");
+        doc.workbook().worksheet("Sheet1").cell("A2").value() = 7;
+        doc.save();    // replaces the mapped file
+        doc.close();
+
+        doc.open(newfile);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<std::string>() == "mapped");
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A2").value().get<int>() == 7);
+        doc.close();
+    }
+
+    /**
+     * @test Open a document with several worksheets, parsing all or selected worksheets concurrently during open.
+     */
+    SECTION("Open with parallel worksheet pre-parse")
+    {
+        {
+            XLDocument doc;
+            doc.create(newfile, XLForceOverwrite);
+            for (int i = 2; i <= 6; ++i) doc.workbook().addWorksheet("Sheet" + std::to_string(i));
+            for (int i = 1; i <= 6; ++i) {
+                auto wks = doc.workbook().worksheet("Sheet" + std::to_string(i));
+                for (uint32_t row = 1; row <= 100; ++row) wks.cell(row, 1).value() = static_cast<int64_t>(row * i);
+            }
+            doc.save();
+            doc.close();
+        }
+
+        XLOpenOptions options;
+        options.preParseWorksheets = true;
+        options.preParseThreads    = 4;
+
+        XLDocument doc;
+        doc.open(newfile, options);
+        for (int i = 1; i <= 6; ++i) {
+            auto wks = doc.workbook().worksheet("Sheet" + std::to_string(i));
+            REQUIRE(wks.cell(1, 1).value().get<int64_t>() == i);
+            REQUIRE(wks.cell(100, 1).value().get<int64_t>() == 100 * i);
+        }
+        doc.close();
+
+        options.preParseSheets = { "Sheet3", "Sheet5" };
+        doc.open(newfile, options);
+        REQUIRE(doc.workbook().worksheet("Sheet5").cell(50, 1).value().get<int64_t>() == 250);
+        REQUIRE(doc.workbook().worksheet("Sheet2").cell(50, 1).value().get<int64_t>() == 100);
+        doc.close();
+
+        options.preParseSheets = { "NoSuchSheet" };
+        REQUIRE_THROWS_AS(doc.open(newfile, options), XLInputError);
+        doc.close();
+    }
+
+    /**
+     * @test Stream a worksheet from the archive while other worksheets of the same document are parsed in the background.
+     */
+    SECTION("Stream a worksheet during background parsing")
+    {
+        {
+            XLDocument doc;
+            doc.create(newfile, XLForceOverwrite);
+            for (int i = 2; i <= 6; ++i) doc.workbook().addWorksheet("Sheet" + std::to_string(i));
+            for (int i = 1; i <= 6; ++i) {
+                auto wks = doc.workbook().worksheet("Sheet" + std::to_string(i));
+                for (uint32_t row = 1; row <= 1000; ++row) wks.cell(row, 1).value() = static_cast<int64_t>(row * i);
+            }
+            doc.save();
+            doc.close();
+        }
+
+        XLOpenOptions options;
+        options.preParseWorksheets = true;
+        options.preParseSheets     = { "Sheet2" };
+
+        XLDocument doc;
+        doc.open(newfile, options);
+        auto     reader = doc.workbook().streamReader("Sheet1");
+        int64_t  rows   = 0;
+        for (int i = 3; i <= 6; ++i) {
+            doc.workbook().prefetch("Sheet" + std::to_string(i));
+            for (int n = 0; n < 100 && reader.nextRow(); ++n) REQUIRE(reader.values()[0].get<int64_t>() == ++rows);
+        }
+        while (reader.nextRow()) REQUIRE(reader.values()[0].get<int64_t>() == ++rows);
+        REQUIRE(rows == 1000);
+        for (int i = 2; i <= 6; ++i)
+            REQUIRE(doc.workbook().worksheet("Sheet" + std::to_string(i)).cell(1000, 1).value().get<int64_t>() == 1000 * i);
+        doc.close();
+    }
+
+    /**
+     * @test Walk the worksheets of a document while the next worksheet is loaded in the background.
+     */
+    SECTION("Prefetch the next worksheet")
+    {
+        {
+            XLDocument doc;
+            doc.create(newfile, XLForceOverwrite);
+            for (int i = 2; i <= 4; ++i) doc.workbook().addWorksheet("Sheet" + std::to_string(i));
+            for (int i = 1; i <= 4; ++i) doc.workbook().worksheet("Sheet" + std::to_string(i)).cell("B2").value() = i;
+            doc.save();
+            doc.close();
+        }
+
+        XLDocument doc;
+        doc.open(newfile);
+        const auto names = doc.workbook().worksheetNames();
+        REQUIRE(names.size() == 4);
+        doc.prefetch(names[0]).wait();
+        for (size_t i = 0; i < names.size(); ++i) {
+            if (i + 1 < names.size()) doc.workbook().prefetch(names[i + 1]);
+            REQUIRE(doc.workbook().worksheet(names[i]).cell("B2").value().get<int>() == static_cast<int>(i + 1));
+        }
+        REQUIRE_THROWS_AS(doc.prefetch("NoSuchSheet"), XLInputError);
+
+        // ===== Pending prefetches must not get in the way of save and close
+        doc.prefetch("Sheet3");
+        doc.workbook().worksheet("Sheet1").cell("C3").value() = "saved";
+        doc.save();
+        doc.prefetch("Sheet4");
+        doc.close();
+
+        doc.open(newfile);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("C3").value().get<std::string>() == "saved");
+        REQUIRE(doc.workbook().worksheet("Sheet3").cell("B2").value().get<int>() == 3);
+        doc.close();
+    }
+
+    /**
+     * @test Walk a document with a memory budget that holds a single worksheet: worksheets are evicted, modified ones written
+     *       to the archive, and reloaded with their content intact.
+     */
+    SECTION("Memory budget with LRU eviction")
+    {
+        {
+            XLDocument doc;
+            doc.create(newfile, XLForceOverwrite);
+            for (int i = 2; i <= 4; ++i) doc.workbook().addWorksheet("Sheet" + std::to_string(i));
+            for (int i = 1; i <= 4; ++i) {
+                auto wks = doc.workbook().worksheet("Sheet" + std::to_string(i));
+                for (uint32_t row = 1; row <= 50; ++row) wks.cell(row, 1).value() = static_cast<int64_t>(row * i);
+            }
+            doc.save();
+            doc.close();
+        }
+
+        XLDocument doc;
+        doc.setMemoryBudget(1);    // smaller than any worksheet: only the worksheet in use stays loaded
+        doc.open(newfile);
+        REQUIRE(doc.memoryBudget() == 1);
+        for (int i = 1; i <= 4; ++i)
+            REQUIRE(doc.workbook().worksheet("Sheet" + std::to_string(i)).cell(50, 1).value().get<int64_t>() == 50 * i);
+        REQUIRE(doc.evictionCount() >= 3);
+        REQUIRE(doc.spillCount() == 0);    // the worksheets were only read
+
+        // ===== Modify a worksheet, evict it by accessing another one, and read it back
+        doc.workbook().worksheet("Sheet1").cell("B1").value() = "spilled";
+        REQUIRE(doc.workbook().worksheet("Sheet2").cell(1, 1).value().get<int64_t>() == 2);
+        REQUIRE(doc.spillCount() >= 1);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("B1").value().get<std::string>() == "spilled");
+        REQUIRE(doc.reloadCount() >= 1);
+
+        // ===== A live cell pins its worksheet: accessing another worksheet exceeds the budget instead of evicting it
+        {
+            auto       cell      = doc.workbook().worksheet("Sheet3").cell("A2");
+            const auto evictions = doc.evictionCount();
+            REQUIRE(doc.workbook().worksheet("Sheet4").cell(2, 1).value().get<int64_t>() == 8);
+            REQUIRE(doc.evictionCount() == evictions);
+            REQUIRE(cell.value().get<int64_t>() == 6);
+        }
+        doc.save();
+        doc.close();
+        REQUIRE(doc.evictionCount() == 0);
+
+        doc.setMemoryBudget(XLNoMemoryBudget);
+        doc.open(newfile);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("B1").value().get<std::string>() == "spilled");
+        REQUIRE(doc.workbook().worksheet("Sheet4").cell(10, 1).value().get<int64_t>() == 40);
+        REQUIRE(doc.evictionCount() == 0);
+        doc.close();
+    }
+
+    /**
+     * @test Read a worksheet through cells, rows and ranges: the worksheet is not modified, so eviction drops it instead of
+     *       writing it to the archive.
+     */
+    SECTION("Read without modification")
+    {
+        {
+            XLDocument doc;
+            doc.create(newfile, XLForceOverwrite);
+            doc.workbook().addWorksheet("Sheet2");
+            auto wks = doc.workbook().worksheet("Sheet1");
+            for (uint32_t row = 1; row <= 20; ++row) wks.cell(row, 2).value() = static_cast<int64_t>(row);
+            doc.workbook().worksheet("Sheet2").cell("A1").value() = "other";
+            doc.save();
+            doc.close();
+        }
+
+        XLDocument doc;
+        doc.setMemoryBudget(1);
+        doc.open(newfile);
+        {
+            const auto wks = doc.workbook().worksheet("Sheet1");
+            int64_t    sum = 0;
+            for (auto& cell : wks.range().existingCells()) sum += cell.value().get<int64_t>();
+            REQUIRE(sum == 210);
+            REQUIRE(wks.cell("B20").value().get<int64_t>() == 20);
+            REQUIRE(wks.row(5).findCell(2).value().get<int64_t>() == 5);
+            REQUIRE(wks.findCell("C1").empty());
+            REQUIRE(wks.lastCell().address() == "B20");
+        }
+        REQUIRE(doc.workbook().worksheet("Sheet2").cell("A1").value().get<std::string>() == "other");
+        REQUIRE(doc.evictionCount() >= 1);
+        REQUIRE(doc.spillCount() == 0);
+
+        doc.workbook().worksheet("Sheet1").cell("B1").value() = 100;
+        REQUIRE(doc.workbook().worksheet("Sheet2").cell("A1").value().get<std::string>() == "other");
+        REQUIRE(doc.spillCount() == 1);
+        doc.close();
+    }
+
+    /**
+     * @test Open a document with the read-only profile: values read as usual, modifications of the document are rejected.
+     */
+    SECTION("Open read-only")
+    {
+        {
+            XLDocument doc;
+            doc.create(newfile, XLForceOverwrite);
+            auto wks = doc.workbook().worksheet("Sheet1");
+            wks.cell("A1").value() = "read only";
+            wks.cell("A2").value() = " ";    // whitespace-only values must survive the minimal parse settings
+            wks.cell("A3").value() = 3.25;
+            doc.setProperty(XLProperty::Title, "Read-only test");
+            doc.save();
+            doc.close();
+        }
+
+        XLDocument doc;
+        doc.open(newfile, XLOpenOptions::readOnlyProfile());
+        REQUIRE(doc.isReadOnly());
+        auto wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.cell("A1").value().get<std::string>() == "read only");
+        REQUIRE(wks.cell("A2").value().get<std::string>() == " ");
+        REQUIRE(wks.cell("A3").value().get<double>() == 3.25);
+        REQUIRE(doc.property(XLProperty::Title) == "Read-only test");
+        REQUIRE(doc.styles().cellFormats().count() > 0);    // constructed on first use
+
+        REQUIRE_THROWS_AS(doc.save(), XLException);
+        REQUIRE_THROWS_AS(doc.setProperty(XLProperty::Title, "changed"), XLException);
+        REQUIRE_THROWS_AS(doc.workbook().addWorksheet("Sheet2"), XLException);
+        REQUIRE_THROWS_AS(doc.workbook().worksheet("Sheet1").setName("Renamed"), XLException);
+        REQUIRE_THROWS_AS(wks.cell("B1").value() = "new string", XLException);    // would be appended to the shared strings
+        REQUIRE_THROWS_AS(doc.sharedStrings().clearString(0), XLException);
+        REQUIRE(doc.sharedStrings().stringCount() == 2);
+        wks.cell("B2").value() = "read only";    // in-memory cell changes are neither blocked nor saved
+        wks.cell("B3").value() = 42;
+        REQUIRE(wks.cell("B2").value().get<std::string>() == "read only");
+        doc.close();
+
+        doc.open(newfile);    // the default options allow modifications again
+        REQUIRE_FALSE(doc.isReadOnly());
+        doc.workbook().addWorksheet("Sheet2");
+        doc.close();
+    }
+
+    /**
+     * @test Read shared strings that are decoded on first use, then modify the shared strings of a reopened document.
+     */
+    SECTION("Lazily decoded shared strings")
+    {
+        {
+            XLDocument doc;
+            doc.create(newfile, XLForceOverwrite);
+            auto wks = doc.workbook().worksheet("Sheet1");
+            wks.cell("A1").value() = "plain";
+            wks.cell("A2").value() = "<markup> & \"quotes\"";
+            wks.cell("A3").value() = "  padded  ";
+            wks.cell("A4").value() = "line\nbreak";
+            wks.cell("A5").value() = "plain";
+            doc.save();
+            doc.close();
+        }
+
+        XLDocument doc;
+        doc.open(newfile);
+        auto wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.cell("A4").value().get<std::string>() == "line\nbreak");    // out of order: decoded on first use
+        REQUIRE(wks.cell("A2").value().get<std::string>() == "<markup> & \"quotes\"");
+        REQUIRE(wks.cell("A3").value().get<std::string>() == "  padded  ");
+        REQUIRE(wks.cell("A1").value().get<std::string>() == "plain");
+        REQUIRE(wks.cell("A5").value().get<std::string>() == "plain");
+        const int32_t plainIndex = doc.sharedStrings().getStringIndex("plain");
+        REQUIRE(plainIndex >= 0);
+        REQUIRE(std::string(doc.sharedStrings().getString(plainIndex)) == "plain");
+
+        const int32_t initialCount = doc.sharedStrings().stringCount();
+        wks.cell("B1").value() = "plain";    // existing string
+        wks.cell("B2").value() = "added";
+        REQUIRE(doc.sharedStrings().stringCount() == initialCount + 1);
+        doc.save();
+        doc.close();
+
+        doc.open(newfile);
+        wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.cell("B1").value().get<std::string>() == "plain");
+        REQUIRE(wks.cell("B2").value().get<std::string>() == "added");
+        REQUIRE(wks.cell("A2").value().get<std::string>() == "<markup> & \"quotes\"");
+        doc.close();
+    }
+
+    /**
+     * @test Write shared strings with the XML generation deferred until saving, and switch back to the immediate XML updates.
+     */
+    SECTION("Deferred shared strings XML")
+    {
+        {
+            XLDocument doc;
+            doc.setDeferredSharedStrings(true);
+            doc.create(newfile, XLForceOverwrite);
+            REQUIRE(doc.deferredSharedStrings());
+            auto wks = doc.workbook().worksheet("Sheet1");
+            for (uint32_t row = 1; row <= 1000; ++row) wks.cell(row, 1).value() = "string " + std::to_string(row % 100);
+            wks.cell("B1").value() = " <escaped> & \"padded\" ";
+            wks.cell("B4").value() = "control\x01" "char";    // written as a numeric character reference
+            doc.save();
+
+            wks.cell("B2").value() = "after first save";
+            doc.setDeferredSharedStrings(false);    // updates the XML from the cache
+            wks.cell("B3").value() = "immediate";
+            doc.save();
+            doc.close();
+        }
+
+        XLDocument doc;
+        doc.open(newfile);
+        auto wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.cell(1000, 1).value().get<std::string>() == "string 0");
+        REQUIRE(wks.cell(999, 1).value().get<std::string>() == "string 99");
+        REQUIRE(wks.cell("B1").value().get<std::string>() == " <escaped> & \"padded\" ");
+        REQUIRE(wks.cell("B2").value().get<std::string>() == "after first save");
+        REQUIRE(wks.cell("B3").value().get<std::string>() == "immediate");
+        REQUIRE(wks.cell("B4").value().get<std::string>() == "control\x01" "char");
+        REQUIRE(doc.sharedStrings().stringCount() >= 103);
+        doc.close();
+    }
+
+    /**
+     * @test Deferred shared strings XML is not used for a table with formatted strings, which the cache can not represent.
+     */
+    SECTION("Deferred shared strings XML with formatted strings")
+    {
+        createRichTextDocument(newfile);
+
+        XLDocument doc;
+        doc.setDeferredSharedStrings(true);
+        doc.open(newfile);
+        REQUIRE_FALSE(doc.deferredSharedStrings());
+        doc.workbook().worksheet("Sheet1").cell("B1").value() = "added";
+        doc.save();
+        doc.close();
+        doc.setDeferredSharedStrings(false);
+
+        const std::string sharedStringsXml = readEntry(newfile, "xl/sharedStrings.xml");
+        REQUIRE(sharedStringsXml.find("<rPr>") != std::string::npos);
+        REQUIRE(sharedStringsXml.find("<rPh") != std::string::npos);
+        REQUIRE(sharedStringsXml.find("<phoneticPr") != std::string::npos);
+
+        doc.open(newfile);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<std::string>() == "plain");
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("B1").value().get<std::string>() == "added");
+        doc.close();
+    }
+
+    /**
+     * @test Releasing an unused shared string on save keeps the formatting of the strings loaded from the file.
+     */
+    SECTION("Release unused shared strings with formatted strings")
+    {
+        createRichTextDocument(newfile);
+
+        XLDocument doc;
+        doc.open(newfile);
+        auto wks = doc.workbook().worksheet("Sheet1");
+        wks.cell("A3").value() = "a";
+        wks.cell("A4").value() = "b";
+        wks.cell("A3").value() = 42;    // "a" is released on save
+        doc.save();
+        doc.close();
+
+        const std::string sharedStringsXml = readEntry(newfile, "xl/sharedStrings.xml");
+        REQUIRE(sharedStringsXml.find("<rPr>") != std::string::npos);
+        REQUIRE(sharedStringsXml.find("<rPh") != std::string::npos);
+        REQUIRE(sharedStringsXml.find("<phoneticPr") != std::string::npos);
+        REQUIRE(sharedStringsXml.find("<t>a</t>") == std::string::npos);
+
+        doc.open(newfile);
+        wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.cell("A1").value().get<std::string>() == "plain");
+        REQUIRE(wks.cell("A3").value().get<int>() == 42);
+        REQUIRE(wks.cell("A4").value().get<std::string>() == "b");
+        doc.close();
+    }
+
+    /**
+     * @test Overwrite shared strings read from a file: their references are counted on save, so that they are released.
+     */
+    SECTION("Release shared strings read from the file")
+    {
+        {
+            XLDocument doc;
+            doc.create(newfile, XLForceOverwrite);
+            doc.workbook().addWorksheet("Sheet2");
+            doc.workbook().worksheet("Sheet1").cell("A1").value() = "first";
+            doc.workbook().worksheet("Sheet1").cell("A2").value() = "second";
+            doc.workbook().worksheet("Sheet2").cell("A1").value() = "second";
+            doc.workbook().worksheet("Sheet1").cell("A3").value() = "third";
+            doc.save();
+            doc.close();
+        }
+
+        XLDocument doc;
+        doc.open(newfile);
+        const int32_t count = doc.sharedStrings().stringCount();
+        const int32_t index = doc.sharedStrings().getStringIndex("second");
+        auto          wks   = doc.workbook().worksheet("Sheet1");
+        wks.cell("A1").value() = "second";    // "first" is released, its <si> entry is kept with empty text
+        wks.cell("A3").value() = 3;           // "third" is released and removed, as it is at the end of the table
+        REQUIRE(doc.sharedStrings().referenceCount(index) == XLUnknownReferenceCount);
+        doc.save();
+        REQUIRE(doc.sharedStrings().stringCount() == count - 1);
+        REQUIRE(doc.sharedStrings().getStringIndex("second") == index);
+        REQUIRE(doc.sharedStrings().referenceCount(index) == 3);
+        doc.close();
+
+        const std::string sharedStringsXml = readEntry(newfile, "xl/sharedStrings.xml");
+        REQUIRE(sharedStringsXml.find("first") == std::string::npos);
+        REQUIRE(sharedStringsXml.find("third") == std::string::npos);
+
+        doc.open(newfile);
+        REQUIRE(doc.sharedStrings().stringCount() == count - 1);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<std::string>() == "second");
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A3").value().get<int>() == 3);
+        REQUIRE(doc.workbook().worksheet("Sheet2").cell("A1").value().get<std::string>() == "second");
+        doc.close();
+    }
+
+    /**
+     * @test cleanupSharedStrings and updateSheetName visit all existing cells, including those right of a too narrow <dimension>.
+     */
+    SECTION("Shared strings cleanup and sheet rename beyond the dimension")
+    {
+        {
+            XLDocument doc;
+            doc.create(newfile, XLForceOverwrite);
+            auto wks = doc.workbook().worksheet("Sheet1");
+            wks.cell("A1").value()   = "a";
+            wks.cell("E1").value()   = "b";
+            wks.cell("F1").formula() = "Sheet1!A1";
+            doc.save();
+            doc.close();
+        }
+        {
+            std::string sheetXml = readEntry(newfile, "xl/worksheets/sheet1.xml");
+            const size_t pos     = sheetXml.find("ref=\"A1:F1\"");
+            REQUIRE(pos != std::string::npos);
+            sheetXml.replace(pos, 11, "ref=\"A1:B1\"");    // as written by a producer that got the dimension wrong
+            XLZipArchive archive;
+            archive.open(newfile);
+            archive.addEntry("xl/worksheets/sheet1.xml", sheetXml);
+            archive.save();
+            archive.close();
+        }
+
+        XLDocument doc;
+        doc.open(newfile);
+        doc.cleanupSharedStrings();    // reindexes all shared strings
+        auto wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.columnCount() == 6);    // the foreign dimension is not trusted
+        REQUIRE(wks.lastCell().address() == "F1");
+        wks.updateSheetName("Sheet1", "Data");
+        REQUIRE(wks.cell("A1").value().get<std::string>() == "a");
+        REQUIRE(wks.cell("E1").value().get<std::string>() == "b");
+        REQUIRE(wks.cell("F1").formula().get() == "Data!A1");
+        doc.close();
+    }
+
+    /**
+     * @test A dimension set by the user is kept on save, the automatic dimension A1:lastCell() is written otherwise.
+     */
+    SECTION("Keep a dimension set by the user on save")
+    {
+        XLDocument doc;
+        doc.create(newfile, XLForceOverwrite);
+        auto wks = doc.workbook().worksheet("Sheet1");
+        wks.cell("B2").value() = 1;
+        wks.cell("C3").value() = 2;
+        wks.setDimension("B2:C3");
+        wks.cell("D4").value() = 3;    // outside of the user dimension
+        doc.save();
+        REQUIRE(readEntry(newfile, "xl/worksheets/sheet1.xml").find("<dimension ref=\"B2:C3\"") != std::string::npos);
+
+        wks.setDimension();    // back to the automatic dimension
+        wks.cell("E5").value() = 4;
+        doc.save();
+        REQUIRE(readEntry(newfile, "xl/worksheets/sheet1.xml").find("<dimension ref=\"A1:E5\"") != std::string::npos);
+        doc.close();
+    }
+
+    /**
+     * @test Create, edit, save and re-read a separate document on each of several threads at the same time.
+     */
+    SECTION("Edit separate documents from concurrent threads")
+    {
+        constexpr int threadCount = 8;
+        constexpr int rowCount    = 200;
+
+        std::vector<int>         failures(threadCount, 0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([t, &failures]() {
+                try {
+                    const std::string filename = "./testConcurrentDocument" + std::to_string(t) + ".xlsx";
+                    XLDocument        doc;
+                    doc.create(filename, XLForceOverwrite);
+                    doc.workbook().addWorksheet("Data");
+                    auto wks = doc.workbook().worksheet("Data");
+                    for (uint32_t row = 1; row <= rowCount; ++row) {
+                        wks.cell(row, 1).value() = static_cast<int64_t>(row * t);
+                        wks.cell(row, 2).value() = "Thread " + std::to_string(t) + " row " + std::to_string(row);
+                    }
+                    doc.save();
+                    doc.close();
+
+                    doc.open(filename);
+                    wks = doc.workbook().worksheet("Data");
+                    for (uint32_t row = 1; row <= rowCount; ++row) {
+                        if (wks.cell(row, 1).value().get<int64_t>() != row * t) ++failures[t];
+                        if (wks.cell(row, 2).value().get<std::string>() != "Thread " + std::to_string(t) + " row " + std::to_string(row))
+                            ++failures[t];
+                    }
+                    doc.close();
+                }
+                catch (...) {
+                    ++failures[t];
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        for (int t = 0; t < threadCount; ++t) REQUIRE(failures[t] == 0);
+    }
+
+    /**
+     * @test Create namespaced nodes in separate XML documents from concurrent threads: each thread must get its own
+     *       namespace prefix, not one concatenated by another thread.
+     */
+    SECTION("Namespaced node names from concurrent threads")
+    {
+        constexpr int threadCount = 8;
+        constexpr int nodeCount   = 5000;
+
+        REQUIRE(enable_xml_namespaces());
+        std::vector<int>         failures(threadCount, 0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([t, &failures]() {
+                const std::string prefix = "ns" + std::to_string(t);
+                XMLDocument       xml;
+                xml.load_string(("<" + prefix + ":worksheet xmlns:" + prefix + "=\"urn:test\"><" + prefix + ":sheetData/></" + prefix + ":worksheet>").c_str());
+                XMLNode sheetData = xml.document_element().first_child_of_type();
+                for (int i = 0; i < nodeCount; ++i) {
+                    const XMLNode row = sheetData.append_child("row");
+                    if (std::string(row.pugi::xml_node::name()) != prefix + ":row") ++failures[t];
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        disable_xml_namespaces();
+        for (int t = 0; t < threadCount; ++t) REQUIRE(failures[t] == 0);
+    }
 }
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include <vector>
 #include <list>
 #include <deque>
+#include <optional>
+#include <tuple>
 
 using namespace OpenXLSX;
 
@@ -66,6 +68,44 @@ TEST_CASE("XLRow Tests", "[XLRow]")
 
         doc.save();
     }
+
+    SECTION("Row index")
+    {
+        XLDocument doc;
+        doc.create("./testXLRow2.xlsx");
+        auto wks = doc.workbook().worksheet("Sheet1");
+
+        for (uint32_t rowNumber : { 5u, 1u, 100u, 50u, 2u, 1000u }) wks.cell(rowNumber, 1).value() = static_cast<int64_t>(rowNumber);
+        wks.cell("A2").offset(1, 0).value() = 3;    // creates row 3 without going through the row index
+        REQUIRE(wks.findCell(3, 1).value().get<int64_t>() == 3);
+        wks.cell(3, 2).value() = "B3";    // must not create a second row 3
+
+        REQUIRE(wks.findCell(4, 1).empty());
+        REQUIRE(wks.findCell(50, 1).value().get<int64_t>() == 50);
+        REQUIRE(wks.deleteRow(50));
+        REQUIRE_FALSE(wks.deleteRow(50));
+        REQUIRE(wks.findCell(50, 1).empty());
+        REQUIRE(wks.deleteRow(1000));
+        REQUIRE(wks.rowCount() == 100);
+        wks.cell(200, 1).value() = 200;
+        REQUIRE_THROWS_AS(wks.findCell(0, 1), XLCellAddressError);
+
+        std::vector<uint32_t> rowNumbers;
+        auto                  reader = doc.workbook().streamReader("Sheet1");
+        while (reader.nextRow()) rowNumbers.push_back(reader.rowNumber());
+        REQUIRE(rowNumbers == std::vector<uint32_t> { 1, 2, 3, 5, 100, 200 });
+        REQUIRE(wks.findCell(3, 2).value().get<std::string>() == "B3");
+
+        // ===== Sparse rows: a miss in the gap is resolved from the neighbouring indexed rows
+        wks.cell(MAX_ROWS, 1).value() = "last";
+        REQUIRE(wks.findCell(MAX_ROWS / 2, 1).empty());
+        wks.cell(MAX_ROWS / 2, 1).value() = "middle";
+        REQUIRE(wks.findCell(MAX_ROWS / 2, 1).value().get<std::string>() == "middle");
+        REQUIRE(wks.findCell(MAX_ROWS, 1).value().get<std::string>() == "last");
+        REQUIRE(wks.rowCount() == MAX_ROWS);
+
+        doc.save();
+    }
 }
 
 TEST_CASE("XLRowData Tests", "[XLRowData]")
@@ -594,4 +634,52 @@ TEST_CASE("XLRowIterator Tests", "[XLRowDataRange]")
         REQUIRE(first->rowNumber() == 1);
 
     }
-}
\ No newline at end of file
+}
+TEST_CASE("XLTypedRow Tests", "[XLTypedRow]")
+{
+    SECTION("XLTypedRowWriter & XLTypedRowReader") {
+        XLDocument doc;
+        doc.create("./testXLTypedRow.xlsx");
+        auto wks = doc.workbook().worksheet("Sheet1");
+
+        XLTypedRowWriter<std::string, int64_t, double, bool, std::optional<double>> writer(wks, 2);
+        writer.write(2, "Apples", 42, 0.75, true, 1.5);
+        writer.write(3, std::make_tuple(std::string("Pears"), int64_t { 7 }, 1.25, false, std::optional<double> {}));
+        REQUIRE(wks.cell("B2").value().get<std::string>() == "Apples");
+        REQUIRE(wks.cell("C2").value().get<int64_t>() == 42);
+        REQUIRE(wks.cell("E2").value().get<bool>() == true);
+        REQUIRE(wks.cell("F3").value().type() == XLValueType::Empty);
+        doc.save();
+        doc.close();
+
+        doc.open("./testXLTypedRow.xlsx");
+        wks = doc.workbook().worksheet("Sheet1");
+        XLTypedRowReader<std::string, int64_t, double, bool, std::optional<double>> reader(wks, 2);
+        const auto [name, count, price, flag, extra] = reader.read(2);
+        REQUIRE(name == "Apples");
+        REQUIRE(count == 42);
+        REQUIRE(price == 0.75);
+        REQUIRE(flag);
+        REQUIRE(extra == 1.5);
+
+        struct Fruit { std::string name; int64_t count; double price; bool flag; std::optional<double> extra; } fruit;
+        reader.read(3, fruit.name, fruit.count, fruit.price, fruit.flag, fruit.extra);
+        REQUIRE(fruit.name == "Pears");
+        REQUIRE(fruit.count == 7);
+        REQUIRE_FALSE(fruit.extra.has_value());
+
+        // ===== Missing cells are value-initialized and not created, mismatched types throw like XLCellValue::get
+        reader.read(4, fruit.name, fruit.count, fruit.price, fruit.flag, fruit.extra);
+        REQUIRE(fruit.name.empty());
+        REQUIRE(fruit.count == 0);
+        REQUIRE(wks.rowCount() == 3);
+        XLTypedRowReader<int64_t> mismatch(wks, 2);
+        REQUIRE_THROWS_AS(mismatch.read(2), XLValueTypeError);
+        XLTypedRowReader<double> integerAsDouble(wks, 3);
+        REQUIRE(std::get<0>(integerAsDouble.read(2)) == 42.0);
+        REQUIRE_THROWS_AS(reader.read(0), XLCellAddressError);
+        XLCell cells[2];
+        REQUIRE_THROWS_AS(wks.findCells(MAX_ROWS + 1, 1, 2, cells), XLCellAddressError);
+        doc.close();
+    }
+}
@@ -74,4 +74,239 @@ TEST_CASE("XLSheet Tests", "[XLSheet]")
 
         doc.save();
     }
-}
\ No newline at end of file
+
+    SECTION("XLStreamReader") {
+        XLDocument doc;
+        doc.create("./testXLSheet3.xlsx");
+        auto wks = doc.workbook().worksheet("Sheet1");
+        wks.cell("A1").value() = "Hello";
+        wks.cell("C1").value() = 3.5;
+        wks.cell("B3").value() = 42;
+        wks.cell("D3").value() = true;
+        wks.cell("E3").value() = "A & <B>";
+        doc.save();
+        doc.close();
+
+        for (bool modified : { false, true }) {
+            doc.open("./testXLSheet3.xlsx");
+            if (modified) doc.workbook().worksheet("Sheet1").cell("A4").value() = "World";    // reader has to use the in-memory XML
+
+            auto reader = doc.workbook().streamReader("Sheet1");
+            REQUIRE(reader.nextRow());
+            REQUIRE(reader.rowNumber() == 1);
+            REQUIRE(reader.values().size() == 3);
+            REQUIRE(reader.values()[0].get<std::string>() == "Hello");
+            REQUIRE(reader.values()[1].type() == XLValueType::Empty);
+            REQUIRE(reader.values()[2].get<double>() == 3.5);
+
+            REQUIRE(reader.nextRow());
+            REQUIRE(reader.rowNumber() == 3);
+            REQUIRE(reader.values().size() == 5);
+            REQUIRE(reader.values()[1].get<int64_t>() == 42);
+            REQUIRE(reader.values()[3].get<bool>() == true);
+            REQUIRE(reader.values()[4].get<std::string>() == "A & <B>");
+
+            if (modified) {
+                REQUIRE(reader.nextRow());
+                REQUIRE(reader.rowNumber() == 4);
+                REQUIRE(reader.values()[0].get<std::string>() == "World");
+            }
+            REQUIRE_FALSE(reader.nextRow());
+            doc.close();
+        }
+
+        doc.open("./testXLSheet3.xlsx");
+        REQUIRE_THROWS_AS(doc.workbook().streamReader("NoSuchSheet"), XLInputError);
+        doc.close();
+    }
+
+    SECTION("XLStreamWriter") {
+        XLDocument doc;
+        doc.create("./testXLSheet4.xlsx");
+        {
+            auto writer = doc.workbook().streamWriter("Data");
+            writer.appendRow({ XLCellValue("Name"), XLCellValue(), XLCellValue("Value") });
+            writer.skipRows(1);
+            for (int i = 0; i < 1000; ++i) writer.appendRow({ XLCellValue("Item"), XLCellValue(i), XLCellValue(i * 0.5), XLCellValue(i % 2 == 0) });
+            REQUIRE(writer.rowNumber() == 1002);
+            REQUIRE_FALSE(doc.workbook().sheetExists("Data"));    // the worksheet is added on close
+            writer.close();
+            REQUIRE_FALSE(writer.isOpen());
+            REQUIRE_THROWS_AS(writer.appendRow({ XLCellValue(1) }), XLInputError);
+        }
+        REQUIRE_THROWS_AS(doc.workbook().streamWriter("Sheet1"), XLInputError);
+        REQUIRE(doc.workbook().worksheet("Data").cell("B4").value().get<int64_t>() == 1);    // readable before saving
+        {
+            auto writer = doc.workbook().streamWriter("Untouched");    // not accessed before saving: the precompressed entry is saved as-is
+            for (int i = 1; i <= 100; ++i) writer.appendRow({ XLCellValue(i), XLCellValue("Row") });
+            writer.close();
+        }
+        {
+            doc.setStringWritePolicy({ XLStringWriteMode::InlineStrings });    // escaped by the stream writer
+            auto writer = doc.workbook().streamWriter("Inline");
+            writer.appendRow({ XLCellValue("control\x01" "char"), XLCellValue("tab\tand <markup>") });
+            writer.close();
+            doc.setStringWritePolicy({});
+        }
+        doc.save();
+        doc.close();
+
+        doc.open("./testXLSheet4.xlsx");
+        auto untouched = doc.workbook().worksheet("Untouched");
+        REQUIRE(untouched.cell("A1").value().get<int64_t>() == 1);
+        REQUIRE(untouched.cell("B100").value().get<std::string>() == "Row");
+        REQUIRE(untouched.rowCount() == 100);
+        auto inlined = doc.workbook().worksheet("Inline");
+        REQUIRE(inlined.cell("A1").value().get<std::string>() == "control\x01" "char");
+        REQUIRE(inlined.cell("B1").value().get<std::string>() == "tab\tand <markup>");
+        auto wks = doc.workbook().worksheet("Data");
+        REQUIRE(wks.cell("A1").value().get<std::string>() == "Name");
+        REQUIRE(wks.cell("B1").value().type() == XLValueType::Empty);
+        REQUIRE(wks.cell("C1").value().get<std::string>() == "Value");
+        REQUIRE(wks.cell("A2").value().type() == XLValueType::Empty);
+        REQUIRE(wks.cell("A1002").value().get<std::string>() == "Item");
+        REQUIRE(wks.cell("B1002").value().get<int64_t>() == 999);
+        REQUIRE(wks.cell("C1002").value().get<double>() == 499.5);
+        REQUIRE(wks.cell("D1002").value().get<bool>() == false);
+        REQUIRE(wks.rowCount() == 1002);
+        doc.close();
+    }
+
+    SECTION("XLWorksheet::readColumn") {
+        XLDocument doc;
+        doc.create("./testXLSheet5.xlsx");
+        auto wks = doc.workbook().worksheet("Sheet1");
+        wks.cell("A2").value() = 1.5;
+        wks.cell("A3").value() = 2;
+        wks.cell("A4").value() = "text";
+        wks.cell("A6").value() = 4.25;
+        wks.cell("B2").value() = 10;
+        wks.cell("B3").value() = 0.5;
+        wks.cell("B6").value() = -3;
+        wks.cell("C3").value() = true;
+        wks.cell("D9").value() = 99;    // beyond the rows read
+
+        // ===== Single column: missing and non-numeric cells are flagged invalid
+        std::vector<double> values(6, -1.0);
+        uint8_t             validity = 0xFF;
+        REQUIRE(wks.readColumn<double>(1, 1, 6, values.data(), &validity) == 3);
+        REQUIRE(values == std::vector<double> { 0.0, 1.5, 2.0, 0.0, 0.0, 4.25 });
+        REQUIRE(validity == 0b100110);
+
+        // ===== Struct of arrays: integers do not accept floating point cells, bools only accept boolean cells
+        std::vector<int64_t>  colB(5);
+        std::vector<int64_t>  colA(5);
+        std::vector<uint8_t>  validB(1);
+        std::vector<uint8_t>  validA(1);
+        int64_t* const        intColumns[] { colB.data(), colA.data() };
+        uint8_t* const        intValidity[] { validB.data(), validA.data() };
+        REQUIRE(wks.readColumns<int64_t>({ 2, 1 }, 2, 6, intColumns, intValidity) == 3);
+        REQUIRE(colB == std::vector<int64_t> { 10, 0, 0, 0, -3 });
+        REQUIRE(validB[0] == 0b10001);
+        REQUIRE(colA == std::vector<int64_t> { 0, 2, 0, 0, 0 });
+        REQUIRE(validA[0] == 0b00010);
+
+        bool flags[2] { false, false };
+        REQUIRE(wks.readColumn<bool>(3, 2, 3, flags) == 1);
+        REQUIRE_FALSE(flags[0]);
+        REQUIRE(flags[1]);
+
+        // ===== Rows are not created by reading
+        double outside[3];
+        REQUIRE(wks.readColumn<double>(1, 100, 102, outside) == 0);
+        REQUIRE(wks.rowCount() == 9);
+        REQUIRE_THROWS_AS(wks.readColumn<double>(0, 1, 2, outside), XLCellAddressError);
+        REQUIRE_THROWS_AS(wks.readColumn<double>(1, 3, 2, outside), XLCellAddressError);
+        doc.close();
+    }
+
+    SECTION("XLWorksheet::writeBlock") {
+        XLDocument doc;
+        doc.create("./testXLSheet6.xlsx");
+        auto wks = doc.workbook().worksheet("Sheet1");
+        wks.cell("C3").value() = "overwritten";
+        wks.cell("E3").value() = "kept";
+        wks.cell("A4").value() = 1;
+
+        // ===== A 3x2 block out of a 3x3 array (stride 3), merged with the existing cells C3 and A4
+        const std::vector<double> matrix { 1.5, 2.5, -1, 3.5, 4.5, -1, 5.5, 6.5, -1 };
+        wks.writeBlock<double>(XLCellReference("C2"), 3, 2, matrix.data(), 3);
+        REQUIRE(wks.cell("C2").value().get<double>() == 1.5);
+        REQUIRE(wks.cell("D2").value().get<double>() == 2.5);
+        REQUIRE(wks.cell("C3").value().get<double>() == 3.5);
+        REQUIRE(wks.cell("D3").value().get<double>() == 4.5);
+        REQUIRE(wks.cell("D4").value().get<double>() == 6.5);
+        REQUIRE(wks.cell("E3").value().get<std::string>() == "kept");
+        REQUIRE(wks.cell("A4").value().get<int64_t>() == 1);
+        REQUIRE(doc.sharedStrings().referenceCount(doc.sharedStrings().getStringIndex("overwritten")) == 0);
+
+        const std::vector<int64_t>     integers { 7, 8 };
+        const bool                     flags[] { true, false };
+        const std::vector<std::string> strings { "a", " b ", "a" };
+        wks.writeBlock<int64_t>(XLCellReference("A6"), 1, 2, integers.data());
+        wks.writeBlock<bool>(XLCellReference("A7"), 2, 1, flags);
+        wks.writeBlock<std::string>(XLCellReference("B7"), 1, 3, strings.data());
+        REQUIRE(doc.sharedStrings().referenceCount(doc.sharedStrings().getStringIndex("a")) == 2);
+        REQUIRE_THROWS_AS(wks.writeBlock<int64_t>(XLCellReference(MAX_ROWS, 1), 2, 1, integers.data()), XLCellAddressError);
+        doc.save();
+        doc.close();
+
+        // ===== Cells are written in order, so that iterating the rows finds them
+        doc.open("./testXLSheet6.xlsx");
+        wks = doc.workbook().worksheet("Sheet1");
+        const auto row3 = wks.row(3).values<std::vector<XLCellValue>>();
+        REQUIRE(row3.size() == 5);
+        REQUIRE(row3[2].get<double>() == 3.5);
+        REQUIRE(row3[3].get<double>() == 4.5);
+        REQUIRE(row3[4].get<std::string>() == "kept");
+        REQUIRE(wks.cell("C4").value().get<double>() == 5.5);
+        REQUIRE(wks.cell("B6").value().get<int64_t>() == 8);
+        REQUIRE(wks.cell("A7").value().get<bool>() == true);
+        REQUIRE(wks.cell("A8").value().get<bool>() == false);
+        REQUIRE(wks.cell("C7").value().get<std::string>() == " b ");
+        REQUIRE(wks.cell("D7").value().get<std::string>() == "a");
+        doc.close();
+    }
+
+    SECTION("XLWorksheet column extent and dimension") {
+        XLDocument doc;
+        doc.create("./testXLSheet7.xlsx");
+        auto wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.columnCount() == 0);
+
+        // ===== Every way of creating cells extends the column count
+        wks.cell("B2").value() = 1;
+        REQUIRE(wks.columnCount() == 2);
+        wks.cell("B2").offset(1, 3).value() = 2;    // E3
+        REQUIRE(wks.columnCount() == 5);
+        wks.row(4).values() = std::vector<int> { 1, 2, 3, 4, 5, 6 };
+        REQUIRE(wks.columnCount() == 6);
+        for (auto& cell : wks.range(XLCellReference("A5"), XLCellReference("G5"))) cell.value() = 0;
+        REQUIRE(wks.columnCount() == 7);
+        const double block[] { 1.5 };
+        wks.writeBlock<double>(XLCellReference("H6"), 1, 1, block);
+        REQUIRE(wks.columnCount() == 8);
+        REQUIRE(wks.lastCell().address() == "H6");
+
+        // ===== Deleting the widest row shrinks it, deleting a narrower row does not
+        REQUIRE(wks.deleteRow(6));
+        REQUIRE(wks.columnCount() == 7);
+        REQUIRE(wks.deleteRow(2));
+        REQUIRE(wks.columnCount() == 7);
+        REQUIRE(wks.deleteRow(5));
+        REQUIRE(wks.columnCount() == 6);
+        REQUIRE(wks.lastCell().address() == "F4");
+        doc.save();
+        doc.close();
+
+        // ===== After reopening, the column count is determined again from the rows
+        doc.open("./testXLSheet7.xlsx");
+        wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.rowCount() == 4);
+        REQUIRE(wks.columnCount() == 6);
+        wks.cell("J1").value() = "wide";
+        REQUIRE(wks.columnCount() == 10);
+        REQUIRE(wks.lastCell().address() == "J4");
+        doc.close();
+    }
+}